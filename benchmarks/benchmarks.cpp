@@ -60,3 +60,248 @@ BENCHMARK("parse twitter.json", [](benchpress::context* ctx)
         j.json_unpack(json.c_str(), json.length() );
     }
 })
+
+struct skip_all
+{
+    skip_all():
+        none(0)
+    {}
+
+    int none;
+    DEFINE_JSON_ATTRIBUTES(none)
+};
+
+BENCHMARK("skip members of citm_catalog.json", [](benchpress::context* ctx)
+{
+	std::ifstream inputs_json("files/nativejson-benchmark/citm_catalog.json");
+    std::string json( (std::istreambuf_iterator<char>(inputs_json) ), (std::istreambuf_iterator<char>() ));
+
+	ctx->reset_timer();
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        skip_all s;
+        s.json_unpack(json.c_str(), json.length() );
+    }
+})
+
+BENCHMARK("pack strings of twitter.json", [](benchpress::context* ctx)
+{
+	std::ifstream inputs_json("files/nativejson-benchmark/twitter.json");
+    std::string json( (std::istreambuf_iterator<char>(inputs_json) ), (std::istreambuf_iterator<char>() ));
+
+    std::vector<std::string> texts;
+    for (size_t pos = 0, end; pos < json.length(); pos = end)
+    {
+        end = std::min(pos + 4096, json.length());
+        while (end < json.length() && (json[end] & 0xC0) == 0x80)   // keep UTF-8 sequences whole
+            ++end;
+        texts.push_back( json.substr(pos, end - pos) );
+    }
+
+	ctx->reset_timer();
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        char* out = jsonpack::json_pack_sequence(texts);
+        free(out);
+    }
+})
+
+BENCHMARK("pack canada.json", [](benchpress::context* ctx)
+{
+	std::ifstream inputs_json("files/nativejson-benchmark/canada.json");
+    std::string json( (std::istreambuf_iterator<char>(inputs_json) ), (std::istreambuf_iterator<char>() ));
+
+    jsonpack::value j;
+    j.json_unpack(json.c_str(), json.length() );
+
+	ctx->reset_timer();
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        char* out = j.json_pack();
+        free(out);
+    }
+})
+
+BENCHMARK("pack canada.json exact size", [](benchpress::context* ctx)
+{
+	std::ifstream inputs_json("files/nativejson-benchmark/canada.json");
+    std::string json( (std::istreambuf_iterator<char>(inputs_json) ), (std::istreambuf_iterator<char>() ));
+
+    jsonpack::value j;
+    j.json_unpack(json.c_str(), json.length() );
+
+	ctx->reset_timer();
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        char* out = jsonpack::json_pack_exact(j);
+        free(out);
+    }
+})
+
+struct small_message
+{
+    small_message():
+        id(42),
+        name("sensor-17"),
+        value(21.5)
+    {}
+
+    int id;
+    std::string name;
+    double value;
+    DEFINE_JSON_ATTRIBUTES(id, name, value)
+};
+
+BENCHMARK("pack 1000 small structs", [](benchpress::context* ctx)
+{
+    small_message msg;
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        for (int m = 0; m < 1000; ++m)
+        {
+            char* out = msg.json_pack();
+            free(out);
+        }
+    }
+})
+
+BENCHMARK("pack 1000 small structs pooled", [](benchpress::context* ctx)
+{
+    small_message msg;
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        for (int m = 0; m < 1000; ++m)
+        {
+            jsonpack::packed out = jsonpack::json_pack_pooled(msg);
+        }
+    }
+})
+
+BENCHMARK("pack 1000 small structs with writer", [](benchpress::context* ctx)
+{
+    small_message msg;
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        for (int m = 0; m < 1000; ++m)
+        {
+            jsonpack::buffer json;
+            jsonpack::writer w(json);
+            w.begin_object()
+                .key(JSONPACK_KEY("id")).value(msg.id)
+                .key(JSONPACK_KEY("name")).value(msg.name)
+                .key(JSONPACK_KEY("value")).value(msg.value)
+             .end_object();
+            free(json.release());
+        }
+    }
+})
+
+BENCHMARK("pack 100000 small structs", [](benchpress::context* ctx)
+{
+    std::vector<small_message> msgs(100000);
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        char* out = jsonpack::json_pack_sequence(msgs);
+        free(out);
+    }
+})
+
+BENCHMARK("pack 100000 small structs parallel", [](benchpress::context* ctx)
+{
+    std::vector<small_message> msgs(100000);
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        char* out = jsonpack::json_pack_sequence_parallel(msgs);
+        free(out);
+    }
+})
+
+BENCHMARK("pack 100000 small structs chunked", [](benchpress::context* ctx)
+{
+    std::vector<small_message> msgs(100000);
+    char chunk[16384];
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        jsonpack::chunked< std::vector<small_message> > out(msgs);
+        while (!out.done())
+            out.next_chunk(chunk, sizeof(chunk));
+    }
+})
+
+BENCHMARK("pack 100000 integers", [](benchpress::context* ctx)
+{
+    std::vector<long long> numbers;
+    for (long long n = 0; n < 100000; ++n)
+        numbers.push_back( (n * 2654435761LL) % 10000000000LL - 5000000000LL );
+
+	ctx->reset_timer();
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        char* out = jsonpack::json_pack_sequence(numbers);
+        free(out);
+    }
+})
+
+BENCHMARK("pack 100000 reals", [](benchpress::context* ctx)
+{
+    std::vector<double> numbers;
+    for (long long n = 0; n < 100000; ++n)
+        numbers.push_back( static_cast<double>(n * 2654435761LL % 1000003) / 97.0 );
+
+	ctx->reset_timer();
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        char* out = jsonpack::json_pack_sequence(numbers);
+        free(out);
+    }
+})
+
+struct blob_message
+{
+    blob_message():
+        id(7),
+        name("upload"),
+        content(4 << 20, 'a')
+    {}
+
+    int id;
+    std::string name;
+    std::string content;
+    DEFINE_JSON_ATTRIBUTES(id, name, content)
+};
+
+BENCHMARK("pack 4 MB string member", [](benchpress::context* ctx)
+{
+    blob_message msg;
+    jsonpack::buffer json;
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        json.clear();
+        msg.json_pack(json);
+    }
+})
+
+BENCHMARK("pack 4 MB string member gathered", [](benchpress::context* ctx)
+{
+    blob_message msg;
+    jsonpack::gather_output out;
+
+    for (size_t i = 0; i < ctx->num_iterations(); ++i)
+    {
+        out.clear();
+        msg.json_pack(out.json());
+    }
+})
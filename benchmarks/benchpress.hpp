@@ -359,6 +359,8 @@ void run_benchmarks(const options& opts) {
  * command-line parser and then executes run_benchmarks.
  */
 #ifdef JSONPACK_BENCHMARK_MAIN
+#include <jsonpack/util/simd.hpp>
+
 benchpress::registration* benchpress::registration::d_this;
 int main(int argc, char** argv) {
     std::chrono::high_resolution_clock::time_point bp_start = std::chrono::high_resolution_clock::now();
@@ -368,10 +370,12 @@ int main(int argc, char** argv) {
 	help+= "bench: run benchmarks matching the regular expression, Default value = .*\n";
 	help+= "benchtime: run enough iterations of each benchmark to take t seconds. Default value = 1\n";
 	help+= "cpu: specify the number of threads to use for parallel benchmarks. Default value = " + std::to_string(std::thread::hardware_concurrency()) + "\n";
+	help+= "simd: scanning kernels to use: scalar, sse4.2, avx2, avx512 or all (each one the CPU supports). Default value = " + std::string(jsonpack::util::simd::name(jsonpack::util::simd::detected())) + "\n";
 	help+= "help: print this help\n";
 	
 
 	std::string cmd_opts;
+	std::string simd_opt;
 	for(int i = 0; i < argc-1; ++i)
 	{
 		cmd_opts = 	argv[i];	
@@ -388,9 +392,34 @@ int main(int argc, char** argv) {
 		if (cmd_opts.compare("-cpu") == 0) {
 			bench_opts.cpu(std::strtol(argv[i+1], nullptr, 10));
 		}
+		if (cmd_opts.compare("-simd") == 0) {
+			simd_opt = argv[i+1];
+		}
 	}
 
-    benchpress::run_benchmarks(bench_opts);
+	if (simd_opt.empty()) {
+		benchpress::run_benchmarks(bench_opts);
+	}
+	else {
+		bool found = false;
+		for (unsigned l = jsonpack::util::SIMD_SCALAR; l < jsonpack::util::SIMD_LEVELS; ++l) {
+			jsonpack::util::simd_level level = static_cast<jsonpack::util::simd_level>(l);
+			if (simd_opt.compare("all") != 0 && simd_opt.compare(jsonpack::util::simd::name(level)) != 0) {
+				continue;
+			}
+			found = true;
+			if (!jsonpack::util::simd::select(level)) {
+				std::cout << "simd " << jsonpack::util::simd::name(level) << ": not supported, skipped" << std::endl;
+				continue;
+			}
+			std::cout << "simd " << jsonpack::util::simd::name(level) << std::endl;
+			benchpress::run_benchmarks(bench_opts);
+		}
+		if (!found) {
+			std::cout << help << std::endl;
+			exit(1);
+		}
+	}
     float duration = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::high_resolution_clock::now() - bp_start
     ).count() / 1000.f;
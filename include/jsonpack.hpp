@@ -20,6 +20,14 @@
 #define JSONPACK_HPP
 
 #include "jsonpack/parser.hpp"
+#include "jsonpack/path.hpp"
+#include "jsonpack/document.hpp"
+#include "jsonpack/chunked.hpp"
+#include "jsonpack/gather.hpp"
+#include "jsonpack/pool.hpp"
+#include "jsonpack/writer.hpp"
+#include "jsonpack/cache.hpp"
+#include "jsonpack/error.hpp"
 #include "jsonpack/exceptions.hpp"
 #include "jsonpack/config.hpp"
 
@@ -44,33 +52,108 @@
     public:                                                             \
     char* json_pack(const bool &pretty = false, const unsigned &indent = 1, unsigned level = 0 )\
     {                                                                   \
-        std::string _keys = jsonpack::util::str::trim( std::string(#__VA_ARGS__) );\
         jsonpack::buffer json;                                          \
+        json_pack(json, pretty, indent, level);                         \
+        return json.release();                                          \
+    }                                                                   \
+    void json_pack(jsonpack::buffer &json, const bool &pretty = false, const unsigned &indent = 1, unsigned level = 0 )\
+    {                                                                   \
+        std::string _keys = jsonpack::util::str::trim( std::string(#__VA_ARGS__) );\
         json.append( "{" , 1);                                          \
         if(pretty){ ++level; }\
         jsonpack::make_json(pretty, indent, level, json, _keys ,__VA_ARGS__);                  \
-        return json.release();                                          \
+    }                                                                   \
+    void json_pack(std::string &out, const bool &pretty = false, const unsigned &indent = 1)\
+    {                                                                   \
+        jsonpack::buffer json(out);                                     \
+        json_pack(json, pretty, indent);                                \
+    }                                                                   \
+    std::size_t json_pack(char* out, const std::size_t &capacity, const bool &pretty = false, const unsigned &indent = 1)\
+    {                                                                   \
+        jsonpack::buffer json(out, capacity);                           \
+        json_pack(json, pretty, indent);                                \
+        json.append("\0", 1);                                           \
+        return json.size() - 1;                                         \
     }                                                                   \
     void json_unpack(const char* json, const std::size_t &len)          \
     {                                                                   \
-        jsonpack::object_t _members;                         \
-        jsonpack::parser p;												\
-         if(p.json_validate(json, len, _members))       				\
-         {                                                              \
-            std::string _keys = jsonpack::util::str::trim( std::string(#__VA_ARGS__) );\
-            jsonpack::make_object(_members, const_cast<char*>(json), _keys, __VA_ARGS__);\
-        }else{throw jsonpack::invalid_json(p.err_msg().c_str());}  		\
+        jsonpack::error err = try_json_unpack(json, len);               \
+        if( !err.ok() ){ err.raise(); }                                 \
+    }                                                                   \
+    jsonpack::error try_json_unpack(const char* json, const std::size_t &len) noexcept\
+    {                                                                   \
+        jsonpack::error err;                                            \
+        try                                                             \
+        {                                                               \
+            jsonpack::object_t _members;                                \
+            jsonpack::parser p;                                         \
+            if(p.try_validate(json, len, _members, err, &_json_filter()))\
+                try_json_unpack(_members, const_cast<char*>(json), err);\
+        }                                                               \
+        catch(const std::bad_alloc&){ err.set(jsonpack::JERR_ALLOC, jsonpack::error::npos); }\
+        return err;                                                     \
     }                                                                   \
     void json_unpack(const jsonpack::object_t &json, char* json_ptr)    \
     {                                                                   \
-        std::string _keys = jsonpack::util::str::trim( std::string(#__VA_ARGS__) );\
-        jsonpack::make_object(json, json_ptr, _keys, __VA_ARGS__);      \
+        jsonpack::make_object(json, json_ptr, _json_keys(), __VA_ARGS__);\
+    }                                                                   \
+    bool try_json_unpack(const jsonpack::object_t &json, char* json_ptr, jsonpack::error &err) noexcept\
+    {                                                                   \
+        return jsonpack::try_make_object(json, json_ptr, _json_keys(), err, __VA_ARGS__);\
+    }                                                                   \
+    template<typename Fn>                                               \
+    void _json_member(const std::size_t &index, Fn &fn) const           \
+    {                                                                   \
+        jsonpack::visit_member(index, fn, _json_keys(), __VA_ARGS__);   \
+    }                                                                   \
+    const jsonpack::key_filter& _json_filter() const                    \
+    {                                                                   \
+        static const jsonpack::key_filter _filter = jsonpack::mark_raw( \
+                    jsonpack::key_filter( jsonpack::util::str::trim( std::string(#__VA_ARGS__) ) ), 0, __VA_ARGS__);\
+        return _filter;                                                 \
+    }                                                                   \
+    const jsonpack::key_handle* _json_keys() const                      \
+    {                                                                   \
+        static const std::vector<jsonpack::key_handle> _keys = jsonpack::make_key_handles(_json_filter());\
+        return _keys.data();                                            \
     }
 
 
 JSONPACK_API_BEGIN_NAMESPACE
 
 
+/**
+ * Serialize obj into one allocation of the exact size: a first pass only
+ * measures, the second writes. Serializing twice costs more time than the
+ * doubling of json_pack, but the result has no slack and the peak memory
+ * is the output size, e.g. for snapshots close to the memory limit.
+ * For DEFINE_JSON_ATTRIBUTES types and jsonpack::value, the caller must
+ * free() the result.
+ */
+template<typename T>
+inline char* json_pack_exact(const T &obj, const bool &pretty = false, const unsigned &indent = 1)
+{
+    T &o = const_cast<T&>(obj);
+
+    std::size_t len = o.json_pack(nullptr, 0, pretty, indent);
+    char *out = static_cast<char*>( malloc(len + 1) );
+    if(!out)
+        throw alloc_error();
+
+    o.json_pack(out, len + 1, pretty, indent);
+    return out;
+}
+
+/**
+ * Serialize obj into a block of the calling thread's buffer pool, for
+ * DEFINE_JSON_ATTRIBUTES types and jsonpack::value
+ */
+template<typename T>
+inline packed json_pack_pooled(const T &obj, const bool &pretty = false, const unsigned &indent = 1)
+{
+    return packed::make( [&](buffer &json){ const_cast<T&>(obj).json_pack(json, pretty, indent); } );
+}
+
 ////============================== SEQUENCES ==============================================
 
 /**
@@ -89,29 +172,160 @@ inline char* json_pack_sequence(const Seq& seq,
     return json.release();
 }
 
+/**
+ * Same as above appending to a caller's buffer or string
+ */
+template<typename Seq>
+inline void json_pack_sequence(const Seq& seq, buffer &json,
+                               const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    type::json_traits< Seq >::append(json, seq, pretty, indent, level);
+    json.erase_last_comma();
+}
+
+template<typename Seq>
+inline void json_pack_sequence(const Seq& seq, std::string &out,
+                               const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    jsonpack::buffer json(out);
+    json_pack_sequence(seq, json, pretty, indent, level);
+}
+
+/**
+ * Same as above into a block of the calling thread's buffer pool
+ */
+template<typename Seq>
+inline packed json_pack_sequence_pooled(const Seq& seq,
+                                        const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    return packed::make( [&](buffer &json){ json_pack_sequence(seq, json, pretty, indent, level); } );
+}
+
+/**
+ * Same as above into out[0, capacity), e.g. a stack array. Returns the
+ * length of the JSON text, which was written and null-terminated only if
+ * it is less than capacity.
+ */
+template<typename Seq>
+inline std::size_t json_pack_sequence(const Seq& seq, char* out, const std::size_t &capacity,
+                                      const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    jsonpack::buffer json(out, capacity);
+    type::json_traits< Seq >::append(json, seq, pretty, indent, level);
+    json.erase_last_comma();
+    json.append("\0", 1);
+
+    return json.size() - 1;
+}
+
+/**
+ * Same as json_pack_sequence splitting the items of a random access
+ * sequence (vector, deque, array) across threads, the text is the same.
+ * With threads 0 one per hardware thread; sequences of less than 1024
+ * items per thread use fewer threads or none.
+ */
+template<typename Seq>
+inline char* json_pack_sequence_parallel(const Seq& seq, unsigned threads = 0,
+                                         const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    jsonpack::buffer json;
+    json_pack_sequence_parallel(seq, json, threads, pretty, indent, level);
+
+    return json.release();
+}
+
+template<typename Seq>
+inline void json_pack_sequence_parallel(const Seq& seq, buffer &json, unsigned threads = 0,
+                                        const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    if( threads == 0 )
+        threads = std::thread::hardware_concurrency();
+
+    type::sequence_traits< Seq >::append_parallel(json, seq, threads, pretty, indent, level);
+    json.erase_last_comma();
+}
+
 /**
  * Tempate function to deserialize arrays into standard sequences
  * Allowed sequences:
  * array, vector, deque, list, forward_list, set, multiset, unordered_set, unordered_multiset
+ * Sequences of numbers, booleans or strings are filled while parsing, without the DOM
  */
 template<typename Seq>
-inline void json_unpack_sequence(const char* json, const std::size_t &len, Seq& seq)
+inline typename std::enable_if<type::sequence_of_literals<Seq>::value>::type
+json_unpack_sequence(const char* json, const std::size_t &len, Seq& seq)
 {
-    array_t *arr = new array_t();
+    type::sequence_traits<Seq&>::parse(json, len, seq);
+}
+
+template<typename Seq>
+inline typename std::enable_if<!type::sequence_of_literals<Seq>::value>::type
+json_unpack_sequence(const char* json, const std::size_t &len, Seq& seq)
+{
+    value v(new array_t());   // owned even if validation throws
 
     parser p;
-    if(p.json_validate(json, len, *arr))
+    p.json_validate(json, len, *v._arr);
+    type::json_extract_traits< Seq&, void >::extract(v, const_cast<char*>(json), seq);
+}
+
+/**
+ * Non-throwing json_unpack_sequence: the error has the code and offset
+ * json_unpack_sequence throws with, seq is left partly filled on failure
+ */
+template<typename Seq>
+inline typename std::enable_if<type::sequence_of_literals<Seq>::value, error>::type
+try_json_unpack_sequence(const char* json, const std::size_t &len, Seq& seq) noexcept
+{
+    error err;
+    type::sequence_traits<Seq&>::try_parse(json, len, seq, err);
+    return err;
+}
+
+template<typename Seq>
+inline typename std::enable_if<!type::sequence_of_literals<Seq>::value, error>::type
+try_json_unpack_sequence(const char* json, const std::size_t &len, Seq& seq) noexcept
+{
+    error err;
+    try
     {
-        value v(arr);
+        value v(new array_t());
 
-        type::json_extract_traits< Seq&, void >::extract(v, const_cast<char*>(json), seq);
+        parser p;
+        if( p.try_validate(json, len, *v._arr, err) )
+            type::try_extract(v, const_cast<char*>(json), seq, err);
     }
-    else
+    catch(const std::bad_alloc&)
     {
-        throw jsonpack::invalid_json(p.err_msg().c_str());
+        err.set(JERR_ALLOC, error::npos);
     }
+    return err;
+}
+
+/**
+ * Same as json_unpack_sequence, but the items already in seq are unpacked
+ * over in place and keep their memory, only the tail grows or shrinks.
+ * Members absent from an item keep their previous value.
+ * Allowed sequences:
+ * vector, deque, list (items reused), set, multiset, unordered_set, unordered_multiset
+ */
+template<typename Seq>
+inline typename std::enable_if<type::sequence_of_literals<Seq>::value>::type
+json_merge_sequence(const char* json, const std::size_t &len, Seq& seq)
+{
+    type::sequence_traits<Seq&>::parse(json, len, seq);   // literals are always reused
 }
 
+template<typename Seq>
+inline typename std::enable_if<!type::sequence_of_literals<Seq>::value>::type
+json_merge_sequence(const char* json, const std::size_t &len, Seq& seq)
+{
+    value v(new array_t());   // owned even if validation throws
+
+    parser p;
+    p.json_validate(json, len, *v._arr);
+    type::sequence_traits<Seq&>::merge(v, const_cast<char*>(json), seq);
+}
 
 ////============================== MAPS ==============================================
 
@@ -131,6 +345,50 @@ inline char* json_pack_map(const Map& map,
     return json.release();
 }
 
+/**
+ * Same as above appending to a caller's buffer or string
+ */
+template<typename Map>
+inline void json_pack_map(const Map& map, buffer &json,
+                          const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    type::json_traits< Map >::append(json, map, pretty, indent, level);
+    json.erase_last_comma();
+}
+
+template<typename Map>
+inline void json_pack_map(const Map& map, std::string &out,
+                          const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    jsonpack::buffer json(out);
+    json_pack_map(map, json, pretty, indent, level);
+}
+
+/**
+ * Same as above into a block of the calling thread's buffer pool
+ */
+template<typename Map>
+inline packed json_pack_map_pooled(const Map& map,
+                                   const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    return packed::make( [&](buffer &json){ json_pack_map(map, json, pretty, indent, level); } );
+}
+
+/**
+ * Same as above into out[0, capacity), see json_pack_sequence
+ */
+template<typename Map>
+inline std::size_t json_pack_map(const Map& map, char* out, const std::size_t &capacity,
+                                 const bool&pretty = false, const unsigned& indent = 1, unsigned level = 0)
+{
+    jsonpack::buffer json(out, capacity);
+    type::json_traits< Map >::append(json, map, pretty, indent, level);
+    json.erase_last_comma();
+    json.append("\0", 1);
+
+    return json.size() - 1;
+}
+
 /**
  * Tempate function to deserialize arrays into standard sequences
  * Allowed sequences:
@@ -139,19 +397,11 @@ inline char* json_pack_map(const Map& map,
 template<typename Map>
 inline void json_unpack_map(const char* json, const std::size_t &len, Map& map)
 {
-    object_t *obj = new object_t();
+    value v(new object_t());   // owned even if validation throws
 
     parser p;
-    if(p.json_validate(json, len, *obj))
-    {
-        value v(obj);
-
-        type::json_extract_traits< Map&, void >::extract(v, const_cast<char*>(json), map);
-    }
-    else
-    {
-        throw jsonpack::invalid_json(p.err_msg().c_str());
-    }
+    p.json_validate(json, len, *v._obj);
+    type::json_extract_traits< Map&, void >::extract(v, const_cast<char*>(json), map);
 }
 
 
@@ -21,6 +21,7 @@
 
 #include <string>
 #include <cstring>
+#include <vector>
 
 #include "exceptions.hpp"
 
@@ -29,10 +30,30 @@ JSONPACK_API_BEGIN_NAMESPACE
 class buffer
 {
 public:
+    /**
+     * Piece of a gathered output: bytes referenced in place, or when ref is
+     * null a run of the buffer's own content starting at pos
+     */
+    struct segment
+    {
+        const char* _ref;
+        std::size_t _pos;
+        std::size_t _len;
+    };
+
     buffer(size_t init_size = 8192)
         : _size(0),
           _data(nullptr),
-          _alloc(init_size)
+          _alloc(init_size),
+          _fixed(false),
+          _overflow(false),
+          _last('\0'),
+          _string(nullptr),
+          _spill(),
+          _spilled(false),
+          _segments(nullptr),
+          _threshold(0),
+          _tail(0)
 
     {
         if(init_size == 0)
@@ -50,18 +71,68 @@ public:
         }
     }
 
+    /**
+     * Fixed buffer over the caller's memory, never grown nor freed. Once an
+     * append does not fit nothing more is written, size() keeps counting
+     * the bytes the whole output needs. With capacity 0 it only measures.
+     */
+    buffer(char* data, size_t capacity)
+        : _size(0),
+          _data(data),
+          _alloc(capacity),
+          _fixed(true),
+          _overflow(false),
+          _last('\0'),
+          _string(nullptr),
+          _spill(),
+          _spilled(false),
+          _segments(nullptr),
+          _threshold(0),
+          _tail(0)
+    {}
+
+    /**
+     * Append to out without a final copy: the string is the storage, grown
+     * in place and cut to the written length when the buffer is destroyed.
+     * Not to be release()d.
+     */
+    explicit buffer(std::string &out)
+        : _size(out.size()),
+          _data(nullptr),
+          _alloc(0),
+          _fixed(false),
+          _overflow(false),
+          _last('\0'),
+          _string(&out),
+          _spill(),
+          _spilled(false),
+          _segments(nullptr),
+          _threshold(0),
+          _tail(0)
+    {
+        out.resize(out.capacity());
+        _data = &out[0];
+        _alloc = out.size();
+    }
+
     ~buffer()
     {
-        if(_data != nullptr)
+        if(_string != nullptr)
+            _string->resize(_size);
+        else if(_data != nullptr && !_fixed)
             free(_data);
     }
 
 public:
     void append(const char* buf, std::size_t len)
     {
-        if(_alloc - _size < len)
+        if(len == 0)
+            return;
+
+        if(_size + len > _alloc && !expand_buffer(len))
         {
-            expand_buffer(len);
+            discard(buf[len - 1], len);
+            return;
         }
         memcpy(_data + _size, buf, len);
         _size += len;
@@ -71,9 +142,10 @@ public:
     {
         if(count)
         {
-            if(_alloc - _size < count)
+            if(_size + count > _alloc && !expand_buffer(count))
             {
-                expand_buffer(count);
+                discard(c, count);
+                return;
             }
 
             std::memset(_data + _size, c, count);
@@ -81,10 +153,103 @@ public:
         }
     }
 
+    /**
+     * Room to write at most n bytes in place, e.g. the digits of a number:
+     * reserve() returns where, commit() takes the count written. When a
+     * fixed buffer has no room the bytes go to a side area, then commit()
+     * copies them if they fit after all or only counts them.
+     */
+    char* reserve(std::size_t n)
+    {
+        if(_size + n > _alloc && !expand_buffer(n))
+        {
+            if(_spill.size() < n)
+                _spill.resize(n);
+            _spilled = true;
+            return &_spill[0];
+        }
+        return _data + _size;
+    }
+
+    void commit(std::size_t k)
+    {
+        if(_spilled)
+        {
+            _spilled = false;
+            if(!_overflow && _size + k <= _alloc)
+            {
+                memcpy(_data + _size, _spill.data(), k);
+                _size += k;
+            }
+            else if(k)
+            {
+                discard(_spill[k - 1], k);
+            }
+            return;
+        }
+        _size += k;
+    }
+
+    /**
+     * Append bytes that are already JSON text. When gathering, runs of at
+     * least the threshold are referenced instead of copied: they must stay
+     * alive and unchanged until the output is written.
+     */
+    void append_large(const char* buf, std::size_t len)
+    {
+        if(!gathers(len))
+        {
+            append(buf, len);
+            return;
+        }
+
+        close_tail();
+        segment ref = { buf, 0, len };
+        _segments->push_back(ref);
+    }
+
+    /**
+     * Whether append_large() would reference len bytes
+     */
+    bool gathers(std::size_t len) const
+    {
+        return _segments != nullptr && len >= _threshold;
+    }
+
+    /**
+     * Record runs given to append_large() in segments from now on, the
+     * content after the last one is left to tail(). Used by gather_output.
+     */
+    void gather(std::vector<segment>* segments, std::size_t threshold)
+    {
+        _segments = segments;
+        _threshold = threshold;
+        _tail = _size;
+    }
+
+    /**
+     * Start of the content after the last referenced run
+     */
+    size_t tail() const
+    {
+        return _tail;
+    }
+
     void erase_last_comma()
     {
-        if(_size > 0 && _data[_size-1] == ',')
+        if(_size > _tail && (_overflow ? _last : _data[_size-1]) == ',')
+        {
             _size--;
+            _last = '\0';
+        }
+    }
+
+    /**
+     * A fixed buffer ran out of space, its content is incomplete
+     */
+    bool overflow() const
+    {
+        return _overflow;
     }
 
     char* data()
@@ -115,10 +280,89 @@ public:
     void clear()
     {
         _size = 0;
+        _overflow = false;
+        _tail = 0;
+    }
+
+    /**
+     * Write into the malloc'd block data of alloc bytes from now on, the
+     * content and current memory are dropped. Used by the buffer pool.
+     */
+    void adopt(char* data, size_t alloc)
+    {
+        if(_data != nullptr)
+            free(_data);
+
+        _data = data;
+        _alloc = alloc;
+        _size = 0;
+        _tail = 0;
+    }
+
+    /**
+     * Hand the memory over as is, alloc gets its size
+     */
+    char* detach(size_t &alloc)
+    {
+        char* tmp = _data;
+        alloc = _alloc;
+        _size = 0;
+        _tail = 0;
+        _data = nullptr;
+        _alloc = 0;
+        return tmp;
     }
 
 private:
-    void expand_buffer(size_t len)
+    void close_tail()
+    {
+        if(_size > _tail)
+        {
+            segment own = { nullptr, _tail, _size - _tail };
+            _segments->push_back(own);
+        }
+        _tail = _size;
+    }
+
+    /**
+     * Account for bytes not written, last is the final one
+     */
+    void discard(const char last, size_t len)
+    {
+        _overflow = true;
+        _last = last;
+        _size += len;
+    }
+
+    /**
+     * False if the buffer is fixed
+     */
+    bool expand_buffer(size_t len)
+    {
+        if(_fixed)
+            return false;
+
+        if(_string != nullptr)
+        {
+            _string->resize( grown_size(len) );
+            _data = &(*_string)[0];
+            _alloc = _string->size();
+            return true;
+        }
+
+        size_t nsize = grown_size(len);
+        void* tmp = realloc(_data, nsize);
+        if(!tmp)
+        {
+            throw alloc_error();
+        }
+
+        _data = static_cast<char*>(tmp);
+        _alloc = nsize;
+        return true;
+    }
+
+    size_t grown_size(size_t len) const
     {
         size_t nsize = (_alloc > 0) ?
                     _alloc * 2 : 8192;
@@ -134,14 +378,7 @@ private:
             nsize = tmp_nsize;
         }
 
-        void* tmp = realloc(_data, nsize);
-        if(!tmp)
-        {
-            throw alloc_error();
-        }
-
-        _data = static_cast<char*>(tmp);
-        _alloc = nsize;
+        return nsize;
     }
 
 #ifndef _MSC_VER
@@ -159,6 +396,15 @@ private:
     size_t _size;
     char* _data;
     size_t _alloc;
+    bool _fixed;
+    bool _overflow;
+    char _last;         // last byte counted after an overflow
+    std::string* _string;
+    std::string _spill;
+    bool _spilled;
+    std::vector<segment>* _segments;    // not null when gathering
+    size_t _threshold;
+    size_t _tail;
 };
 
 
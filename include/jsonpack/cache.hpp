@@ -0,0 +1,182 @@
+/**
+ *  Jsonpack - Memoized extraction of literals
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_CACHE_HPP
+#define JSONPACK_CACHE_HPP
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+#include "jsonpack/types.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+/**
+ * Side table of decoded literals: the first get<T>() of a node runs the
+ * extraction (number conversion, string unescaping), later ones return the
+ * stored result. Values themselves stay two words, the results live in
+ * per-type arenas owned by the cache and keep their address until clear().
+ *
+ *      jsonpack::value_cache cache;
+ *      const std::string &name = cache.get<std::string>( root.at("name") );
+ *
+ * Entries are keyed by the literal's text, address and length, not by the
+ * node: a literal replaced in place, e.g. by a draft edit, gets an entry of
+ * its own. The texts (documents, drafts) must outlive the cache or the
+ * cache must be cleared first. A cache is not synchronized, use one per
+ * thread when a document is shared.
+ * Supported types: bool, char, integers, float, double and std::string.
+ */
+class value_cache
+{
+public:
+    value_cache():
+        _bools(), _chars(), _ints(), _uints(), _longs(), _ulongs(),
+        _llongs(), _ullongs(), _floats(), _doubles(), _strings()
+    {}
+
+    value_cache(const value_cache&) = delete;
+    value_cache& operator=(const value_cache&) = delete;
+
+    /**
+     * Decoded literal of node, extracted on first access only.
+     * Throws type_error if node does not hold a T.
+     */
+    template<typename T>
+    const T& get(const value &node)
+    {
+        arena<T> &a = select( static_cast<T*>(nullptr) );
+
+        if( node.field() != _POS )
+            throw type_error("Types mismatch");
+
+        span text = { node.data(), node.length() };
+        typename arena<T>::index_t::const_iterator found = a._index.find(text);
+        if( found != a._index.end() )
+            return *found->second;
+
+        if( !type::json_extract_traits<T&, void>::match_token_type(node) )
+            throw type_error("Types mismatch");
+
+        a._items.emplace_back();
+        try
+        {
+            type::json_extract_traits<T&, void>::extract(node, nullptr, a._items.back());
+        }
+        catch(...)
+        {
+            a._items.pop_back();
+            throw;
+        }
+
+        const T *item = &a._items.back();
+        a._index.emplace(text, item);
+        return *item;
+    }
+
+    /**
+     * Count of cached results
+     */
+    std::size_t size() const
+    {
+        return _bools.size() + _chars.size() + _ints.size() + _uints.size() +
+               _longs.size() + _ulongs.size() + _llongs.size() + _ullongs.size() +
+               _floats.size() + _doubles.size() + _strings.size();
+    }
+
+    void clear()
+    {
+        _bools.clear(); _chars.clear(); _ints.clear(); _uints.clear();
+        _longs.clear(); _ulongs.clear(); _llongs.clear(); _ullongs.clear();
+        _floats.clear(); _doubles.clear(); _strings.clear();
+    }
+
+private:
+    /**
+     * Text of a literal in the JSON string
+     */
+    struct span
+    {
+        bool operator==(const span &s) const
+        { return _ptr == s._ptr && _len == s._len; }
+
+        const char* _ptr;
+        std::size_t _len;
+    };
+
+    struct span_hash
+    {
+        std::size_t operator()(const span &s) const
+        { return std::hash<const char*>()(s._ptr) ^ s._len; }
+    };
+
+    /**
+     * Results of one type: a deque never moves its items when growing
+     */
+    template<typename T>
+    struct arena
+    {
+        typedef std::unordered_map<span, const T*, span_hash> index_t;
+
+        arena():
+            _items(),
+            _index()
+        {}
+
+        std::size_t size() const
+        { return _items.size(); }
+
+        void clear()
+        {
+            _index.clear();
+            _items.clear();
+        }
+
+        std::deque<T> _items;
+        index_t _index;
+    };
+
+    arena<bool>& select(bool*) { return _bools; }
+    arena<char>& select(char*) { return _chars; }
+    arena<int>& select(int*) { return _ints; }
+    arena<unsigned int>& select(unsigned int*) { return _uints; }
+    arena<long>& select(long*) { return _longs; }
+    arena<unsigned long>& select(unsigned long*) { return _ulongs; }
+    arena<long long>& select(long long*) { return _llongs; }
+    arena<unsigned long long>& select(unsigned long long*) { return _ullongs; }
+    arena<float>& select(float*) { return _floats; }
+    arena<double>& select(double*) { return _doubles; }
+    arena<std::string>& select(std::string*) { return _strings; }
+
+    arena<bool> _bools;
+    arena<char> _chars;
+    arena<int> _ints;
+    arena<unsigned int> _uints;
+    arena<long> _longs;
+    arena<unsigned long> _ulongs;
+    arena<long long> _llongs;
+    arena<unsigned long long> _ullongs;
+    arena<float> _floats;
+    arena<double> _doubles;
+    arena<std::string> _strings;
+};
+
+JSONPACK_API_END_NAMESPACE
+
+#endif // JSONPACK_CACHE_HPP
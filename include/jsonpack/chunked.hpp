@@ -0,0 +1,462 @@
+/**
+ *  Jsonpack - Serialization in bounded pieces
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_CHUNKED_HPP
+#define JSONPACK_CHUNKED_HPP
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "jsonpack/buffer.hpp"
+#include "jsonpack/type/sequences/sequences.hpp"
+#include "jsonpack/type/maps/maps.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+/**
+ * How chunked walks a type: items of a sequence, members of a map or of a
+ * DEFINE_JSON_ATTRIBUTES struct, or the whole value at once (literals)
+ */
+struct chunk_value
+{};
+
+struct chunk_struct
+{};
+
+struct chunk_sequence
+{
+    static const char open = '[';
+    static const char close = ']';
+
+    template<typename Range>
+    struct item_of
+    {
+        typedef typename Range::value_type type;
+    };
+
+    template<typename It>
+    static auto item(buffer &, const It &it) -> decltype(*it)
+    {
+        return *it;
+    }
+};
+
+struct chunk_map
+{
+    static const char open = '{';
+    static const char close = '}';
+
+    template<typename Range>
+    struct item_of
+    {
+        typedef typename Range::mapped_type type;
+    };
+
+    /**
+     * Writes the key, as maps_traits does
+     */
+    template<typename It>
+    static auto item(buffer &json, const It &it) -> decltype((it->second))
+    {
+        json.append("\"", 1);
+        json.append(it->first.data(), it->first.length());
+        json.append("\":", 2);
+        return it->second;
+    }
+};
+
+template<typename T, typename = void>
+struct chunk_kind
+{
+    typedef chunk_value type;
+};
+
+template<typename T>
+struct chunk_kind<T, typename std::enable_if<type::has_try_unpack<T>::value>::type>
+{
+    typedef chunk_struct type;
+};
+
+template<typename T>
+struct chunk_kind<T, typename std::enable_if<!std::is_same<T, std::string>::value && !type::has_try_unpack<T>::value,
+        decltype(std::declval<const T&>().begin(), void(sizeof(typename T::value_type)))>::type>
+{
+    template<typename U>
+    static chunk_map test(typename U::mapped_type*);
+
+    template<typename U>
+    static chunk_sequence test(...);
+
+    typedef decltype(test<T>(nullptr)) type;
+};
+
+/**
+ * A value formatted a unit at a time, reset() to start on one
+ */
+class chunk_step
+{
+public:
+    virtual ~chunk_step()
+    {}
+
+    /**
+     * Append the next unit of the text, true when it was the last
+     */
+    virtual bool step(buffer &json) = 0;
+
+protected:
+    chunk_step():
+        _pretty(false),
+        _indent(1),
+        _level(0)
+    {}
+
+    void layout(const bool &pretty, const unsigned &indent, const unsigned &level)
+    {
+        _pretty = pretty;
+        _indent = indent;
+        _level = level;
+    }
+
+    void new_line(buffer &json) const
+    {
+        if(_pretty)
+        {
+            json.append("\n", 1);
+            json.append(' ', _indent * _level);
+        }
+    }
+
+    bool _pretty;
+    unsigned _indent;
+    unsigned _level;
+};
+
+template<typename T, typename Kind = typename chunk_kind<T>::type>
+class chunk_writer;
+
+/**
+ * Literals and types without members to walk: one step
+ */
+template<typename T>
+class chunk_writer<T, chunk_value> : public chunk_step
+{
+public:
+    chunk_writer():
+        _obj(nullptr)
+    {}
+
+    void reset(const T &obj, const bool &pretty, const unsigned &indent, const unsigned &level)
+    {
+        layout(pretty, indent, level);
+        _obj = &obj;
+    }
+
+    bool step(buffer &json) override
+    {
+        type::json_traits<T, void>::append(json, *_obj, _pretty, _indent, _level);
+        json.erase_last_comma();
+        return true;
+    }
+
+    chunk_writer(const chunk_writer&) = delete;
+    chunk_writer& operator=(const chunk_writer&) = delete;
+
+private:
+    const T *_obj;
+};
+
+/**
+ * Sequences and maps: the brackets, then a literal item per step. Items
+ * holding containers or structs are walked by steps of their own.
+ */
+template<typename T, typename Kind>
+class chunk_writer : public chunk_step
+{
+public:
+    chunk_writer():
+        _it(),
+        _end(),
+        _item(),
+        _open(false),
+        _in_item(false)
+    {}
+
+    void reset(const T &obj, const bool &pretty, const unsigned &indent, const unsigned &level)
+    {
+        layout(pretty, indent, level);
+        _it = obj.begin();
+        _end = obj.end();
+        _open = false;
+        _in_item = false;
+    }
+
+    bool step(buffer &json) override
+    {
+        if(!_open)
+        {
+            json.append(Kind::open, 1);
+            if(_pretty)
+                ++_level;
+            _open = true;
+            return false;
+        }
+
+        if(_it == _end)
+        {
+            if(_pretty)
+            {
+                --_level;
+                new_line(json);
+            }
+            json.append(Kind::close, 1);
+            return true;
+        }
+
+        if( item(json, typename chunk_kind<item_t>::type()) && ++_it == _end )
+            json.erase_last_comma();
+        return false;
+    }
+
+    chunk_writer(const chunk_writer&) = delete;
+    chunk_writer& operator=(const chunk_writer&) = delete;
+
+private:
+    typedef typename Kind::template item_of<T>::type item_t;
+
+    /**
+     * Literal items are written whole, true once the item is
+     */
+    bool item(buffer &json, chunk_value)
+    {
+        new_line(json);
+        type::json_traits<item_t, void>::append(json, Kind::item(json, _it), _pretty, _indent, _level);
+        return true;
+    }
+
+    template<typename ItemKind>
+    bool item(buffer &json, ItemKind)
+    {
+        if(!_in_item)
+        {
+            new_line(json);
+            _item.reset(Kind::item(json, _it), _pretty, _indent, _level);
+            _in_item = true;
+        }
+
+        if( !_item.step(json) )
+            return false;
+
+        _in_item = false;
+        json.append(",", 1);
+        return true;
+    }
+
+    typename T::const_iterator _it;
+    typename T::const_iterator _end;
+    chunk_writer<item_t> _item;
+    bool _open;
+    bool _in_item;
+};
+
+/**
+ * DEFINE_JSON_ATTRIBUTES types: the scalar members are written whole, a
+ * step runs up to the next member holding a container or struct, which is
+ * then walked by steps of its own
+ */
+template<typename T>
+class chunk_writer<T, chunk_struct> : public chunk_step
+{
+public:
+    chunk_writer():
+        _obj(nullptr),
+        _index(0),
+        _count(0),
+        _open(false),
+        _member()
+    {}
+
+    void reset(const T &obj, const bool &pretty, const unsigned &indent, const unsigned &level)
+    {
+        layout(pretty, indent, level);
+        _obj = &obj;
+        _index = 0;
+        _count = obj._json_filter()._names.size();
+        _open = false;
+        _member.reset();
+    }
+
+    bool step(buffer &json) override
+    {
+        if(!_open)
+        {
+            json.append("{", 1);
+            if(_pretty)
+                ++_level;
+            _open = true;
+        }
+        else if(_member)
+        {
+            if( !_member->step(json) )
+                return false;
+
+            _member.reset();
+            json.append(",", 1);
+        }
+
+        member_visitor visit = { this, &json };
+        while(_index < _count)
+        {
+            _obj->_json_member(_index++, visit);
+            if(_member)
+                return false;
+        }
+
+        json.erase_last_comma();
+        if(_pretty)
+        {
+            --_level;
+            new_line(json);
+        }
+        json.append("}", 1);
+        return true;
+    }
+
+    chunk_writer(const chunk_writer&) = delete;
+    chunk_writer& operator=(const chunk_writer&) = delete;
+
+private:
+    struct member_visitor
+    {
+        template<typename M>
+        void operator()(const key_handle &key, const M &val)
+        {
+            _writer->member(*_json, key, val, typename chunk_kind<M>::type());
+        }
+
+        chunk_writer *_writer;
+        buffer *_json;
+    };
+
+    template<typename M>
+    void member(buffer &json, const key_handle &key, const M &val, chunk_value)
+    {
+        new_line(json);
+        type::json_traits<M, void>::append(json, key._ptr, val, _pretty, _indent, _level);
+    }
+
+    template<typename M, typename Kind>
+    void member(buffer &json, const key_handle &key, const M &val, Kind)
+    {
+        new_line(json);
+        json.append("\"", 1);
+        json.append(key._ptr, key._bytes);
+        json.append("\":", 2);
+
+        chunk_writer<M, Kind> *writer = new chunk_writer<M, Kind>();
+        _member.reset(writer);
+        writer->reset(val, _pretty, _indent, _level);
+    }
+
+    const T *_obj;
+    std::size_t _index;
+    std::size_t _count;
+    bool _open;
+    std::unique_ptr<chunk_step> _member;    // container member being walked
+};
+
+/**
+ * JSON text of a sequence, a map or a struct returned a piece at a time,
+ * e.g. to fill the send buffer of a non-blocking socket when it is
+ * writable, without holding the whole text:
+ *
+ *      jsonpack::chunked< std::vector<order> > out(orders);
+ *      while(!out.done())
+ *      {
+ *          std::size_t n = out.next_chunk(chunk, sizeof(chunk));
+ *          ...
+ *      }
+ *
+ * Items of sequences and members of maps and structs are formatted as the
+ * text drains, nested containers included, so beyond the piece asked for
+ * at most one literal item or the scalar members of one struct are held.
+ * The object must not change until done(); the text is the same as the
+ * one of json_pack_sequence, json_pack_map or json_pack.
+ */
+template<typename T>
+class chunked
+{
+public:
+    explicit chunked(const T &obj, const bool &pretty = false, const unsigned &indent = 1):
+        _writer(),
+        _pending(),
+        _read(0),
+        _last(false)
+    {
+        _writer.reset(obj, pretty, indent, 0);
+    }
+
+    /**
+     * All the text was returned
+     */
+    bool done() const
+    {
+        return _last && _read == _pending.size();
+    }
+
+    /**
+     * Copy the next at most n bytes of the text to out, returns how many.
+     * Less than n only at the end, 0 once done().
+     */
+    std::size_t next_chunk(char* out, std::size_t n)
+    {
+        std::size_t written = 0;
+        while(written < n)
+        {
+            if(_read == _pending.size())
+            {
+                if(_last)
+                    break;
+
+                _pending.clear();
+                _read = 0;
+                while(_pending.size() < n - written && !_last)
+                    _last = _writer.step(_pending);
+                continue;
+            }
+
+            std::size_t count = std::min(n - written, _pending.size() - _read);
+            memcpy(out + written, _pending.data() + _read, count);
+            _read += count;
+            written += count;
+        }
+        return written;
+    }
+
+private:
+    chunk_writer<T> _writer;
+    buffer _pending;
+    std::size_t _read;
+    bool _last;         // the writer made its last step
+};
+
+JSONPACK_API_END_NAMESPACE
+
+#endif // JSONPACK_CHUNKED_HPP
@@ -0,0 +1,227 @@
+/**
+ *  Jsonpack - Immutable documents shared between threads
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_DOCUMENT_HPP
+#define JSONPACK_DOCUMENT_HPP
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "jsonpack/types.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+class document;
+
+/**
+ * Documents are only handed out as const, their reference count is atomic
+ */
+typedef std::shared_ptr<const document> document_ptr;
+
+/**
+ * A parsed JSON text frozen after construction: it owns the text and the
+ * DOM pointing into it and only exposes const navigation (value::find,
+ * value::at, value::items, path), which never writes. Any number of threads
+ * can read the same document without synchronization.
+ */
+class document
+{
+public:
+    /**
+     * Parse a copy of the text, throws invalid_json
+     */
+    static document_ptr parse(const char *json, const std::size_t &len);
+
+    static document_ptr parse(std::string json);
+
+    const value& root() const
+    { return _root; }
+
+    const std::string& text() const
+    { return _text; }
+
+    document(const document&) = delete;
+    document& operator=(const document&) = delete;
+
+private:
+    explicit document(std::string &&json);
+
+    const std::string _text;
+    value _root;
+};
+
+/**
+ * Edited version of a document. Changes copy the containers on the path
+ * from the root to the change (copy-on-write), every other subtree stays
+ * shared with the base document, which is never modified and can still be
+ * read by other threads meanwhile:
+ *
+ *      jsonpack::draft edit(doc);
+ *      edit.root().set( edit.name("region"), edit.string("eu-west") );
+ *      edit.root().edit("routes").push_back( edit.integer(8) );
+ *      char *json = edit.json_pack();
+ *
+ * New member names and literals point to text kept in the draft's arena:
+ * create them with the draft they are added to, and do not let them
+ * outlive it.
+ */
+class draft
+{
+public:
+    explicit draft(document_ptr base);
+
+    value& root()
+    { return _root; }
+
+    const value& root() const
+    { return _root; }
+
+    const document_ptr& base() const
+    { return _base; }
+
+    /**
+     * Member name, escaped if needed
+     */
+    key name(const std::string &name);
+
+    value string(const std::string &str);
+
+    value integer(const long long &number);
+
+    value real(const double &number);
+
+    value boolean(const bool &b);
+
+    /**
+     * Parse a new object or array, throws invalid_json
+     */
+    value parse(const char *json, const std::size_t &len);
+
+    /**
+     * Serialize the edited document, the caller must free() the result
+     */
+    char* json_pack(const bool &pretty = false, const unsigned &indent = 1) const
+    { return _root.json_pack(pretty, indent); }
+
+    draft(const draft&) = delete;
+    draft& operator=(const draft&) = delete;
+
+private:
+    const std::string& store(std::string &&text);
+
+    value literal(const jsonpack_token_type &type, const std::string &text);
+
+    document_ptr _base;
+    std::deque<std::string> _arena;     // never moves its items when growing
+    value _root;
+};
+
+/**
+ * Holder of the current version of a document, replaced as a whole while
+ * readers keep running (read-copy-update).
+ * Readers never lock nor copy the document_ptr. Entering and leaving
+ * costs one atomic increment and one decrement of a counter shared by all
+ * readers of the slot, the same contended cache line an atomic reference
+ * count would be:
+ *
+ *      jsonpack::document_slot::reader doc(slot);
+ *      doc->root().at("routes") ...
+ *
+ * A writer publishes the new version and waits until the readers that may
+ * still see the old one are gone before releasing it. Writers are
+ * serialized between them. A thread must not publish while it is reading
+ * the same slot.
+ */
+class document_slot
+{
+    struct node
+    {
+        explicit node(document_ptr doc):
+            _doc(std::move(doc))
+        {}
+
+        document_ptr _doc;
+    };
+
+public:
+    /**
+     * Read-side critical section, pins the version current at construction
+     */
+    class reader
+    {
+    public:
+        explicit reader(const document_slot &slot);
+        ~reader();
+
+        const document& operator*() const
+        { return *_node->_doc; }
+
+        const document* operator->() const
+        { return _node->_doc.get(); }
+
+        /**
+         * Keep this version beyond the reader's scope (one atomic increment)
+         */
+        document_ptr share() const
+        { return _node->_doc; }
+
+        reader(const reader&) = delete;
+        reader& operator=(const reader&) = delete;
+
+    private:
+        const document_slot &_slot;
+        unsigned _parity;
+        const node *_node;
+    };
+
+    explicit document_slot(document_ptr doc);
+    ~document_slot();
+
+    /**
+     * Make doc the current version. Returns once no reader can see the
+     * previous one.
+     */
+    void publish(document_ptr doc);
+
+    /**
+     * Current version, one atomic increment
+     */
+    document_ptr load() const;
+
+    document_slot(const document_slot&) = delete;
+    document_slot& operator=(const document_slot&) = delete;
+
+private:
+    std::atomic<node*> _current;
+
+    /**
+     * Readers register in _readers[_epoch & 1]. A writer flips the epoch,
+     * then waits for the counter of the previous parity to drain.
+     */
+    mutable std::atomic<unsigned> _epoch;
+    mutable std::atomic<unsigned> _readers[2];
+
+    std::mutex _writer;
+};
+
+JSONPACK_API_END_NAMESPACE
+
+#endif // JSONPACK_DOCUMENT_HPP
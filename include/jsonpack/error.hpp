@@ -0,0 +1,121 @@
+/**
+ *  Jsonpack - Error codes of the non-throwing API
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_ERROR_HPP
+#define JSONPACK_ERROR_HPP
+
+#include <cstring>
+#include <string>
+
+#include "jsonpack/namespace.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+enum jsonpack_token_type : unsigned;
+
+enum error_code : unsigned
+{
+    JERR_NONE = 0,
+
+    // syntax errors, thrown as invalid_json
+    JERR_EMPTY,                 // empty input
+    JERR_NOT_CONTAINER,         // top level value is not an object or array
+    JERR_UNEXPECTED_TOKEN,      // see error::_expected and error::_found
+    JERR_INVALID_VALUE,
+    JERR_EXPECT_MEMBER,         // no member name after a comma
+    JERR_EXPECT_VALUE,          // no value after a comma
+    JERR_INVALID_ESCAPE,
+    JERR_INVALID_UNICODE,
+    JERR_CONTROL_CHARACTER,
+    JERR_LEADING_ZERO,
+
+    // extraction errors, thrown as type_error
+    JERR_TYPE_MISMATCH,
+    JERR_OUT_OF_RANGE,
+
+    // thrown as std::bad_alloc
+    JERR_ALLOC
+};
+
+/**
+ * Failure reported by the try_* functions. Recording one does not allocate,
+ * the text is only built by message().
+ */
+struct error
+{
+    static const std::size_t npos = static_cast<std::size_t>(-1);
+
+    error():
+        _code(JERR_NONE),
+        _offset(npos),
+        _expected(),
+        _found(),
+        _path(),
+        _path_len(0)
+    {}
+
+    bool ok() const
+    { return _code == JERR_NONE; }
+
+    void set(error_code code, std::size_t offset)
+    {
+        _code = code;
+        _offset = offset;
+    }
+
+    /**
+     * Add a member name in front of the path, called from the innermost
+     * member outwards. Names that do not fit are dropped.
+     */
+    void prepend(const char *name, const std::size_t &len)
+    {
+        std::size_t bytes = len + 1;
+        if( _path_len + bytes > sizeof(_path) )
+            return;
+
+        memmove(_path + bytes, _path, _path_len);
+        _path[0] = '/';
+        memcpy(_path + 1, name, len);
+        _path_len += bytes;
+    }
+
+    /**
+     * Members from the root to the one that failed, as a JSON pointer
+     * e.g: "/order/price". Empty for syntax errors.
+     */
+    std::string path() const
+    { return std::string(_path, _path_len); }
+
+    std::string message() const;
+
+    /**
+     * Throw the exception the throwing API uses for this error
+     */
+    [[noreturn]] void raise() const;
+
+    error_code _code;
+    std::size_t _offset;            // in the JSON text, npos if unknown
+    jsonpack_token_type _expected;
+    jsonpack_token_type _found;
+    char _path[96];
+    std::size_t _path_len;
+};
+
+JSONPACK_API_END_NAMESPACE
+
+#endif // JSONPACK_ERROR_HPP
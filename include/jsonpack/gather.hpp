@@ -0,0 +1,120 @@
+/**
+ *  Jsonpack - Scatter/gather output
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_GATHER_HPP
+#define JSONPACK_GATHER_HPP
+
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
+
+#include "jsonpack/buffer.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+/**
+ * JSON text kept as a list of pieces instead of one block: large strings
+ * needing no escape, raw_json members and string literals of a DOM are
+ * referenced where they live, the rest is formatted into an own buffer.
+ * Written with one writev() it saves copying multi-megabyte members:
+ *
+ *      jsonpack::gather_output out;
+ *      msg.json_pack(out.json());
+ *      out.write(fd);
+ *
+ * The referenced data (members of msg, the document of a value) must stay
+ * alive and unchanged until the output is written or cleared.
+ */
+class gather_output
+{
+public:
+    /**
+     * Runs of at least threshold bytes are referenced
+     */
+    explicit gather_output(const std::size_t &threshold = 64 * 1024):
+        _segments(),
+        _json()
+    {
+        _json.gather(&_segments, threshold);
+    }
+
+    /**
+     * The buffer to pack into, e.g. with obj.json_pack(out.json())
+     */
+    buffer& json()
+    { return _json; }
+
+    /**
+     * Call fn(const char* data, std::size_t len) for each piece in order
+     */
+    template<typename Fn>
+    void for_each(const Fn &fn) const
+    {
+        for(const buffer::segment &s : _segments)
+        {
+            if(s._ref != nullptr)
+                fn(s._ref, s._len);
+            else
+                fn(_json.data() + s._pos, s._len);
+        }
+
+        if(_json.size() > _json.tail())
+            fn(_json.data() + _json.tail(), _json.size() - _json.tail());
+    }
+
+    std::size_t pieces() const;
+
+    /**
+     * Bytes of the whole text
+     */
+    std::size_t size() const;
+
+    /**
+     * The text in one string, copying every piece
+     */
+    std::string str() const;
+
+    void clear();
+
+#ifndef _WIN32
+    /**
+     * The pieces as an iovec list, e.g. for sendmsg()
+     */
+    std::vector<struct iovec> iovecs() const;
+
+    /**
+     * writev() the whole text to fd, IOV_MAX pieces at a time, resuming
+     * after partial writes and EINTR. False on error, errno tells which.
+     */
+    bool write(int fd) const;
+#endif
+
+    gather_output(const gather_output&) = delete;
+    gather_output& operator=(const gather_output&) = delete;
+
+private:
+    std::vector<buffer::segment> _segments;
+    buffer _json;
+};
+
+JSONPACK_API_END_NAMESPACE
+
+#endif // JSONPACK_GATHER_HPP
@@ -19,6 +19,8 @@
 #ifndef JSONPACK_ARRAY_OBJECT_HPP
 #define JSONPACK_ARRAY_OBJECT_HPP
 
+#include <memory>
+#include <new>
 #include <vector>
 #include <unordered_map>
 #include <string.h>
@@ -50,6 +52,16 @@ inline std::size_t _hash_bytes(const char* __str, const unsigned long & _bytes)
     return hash;
 }
 
+/**
+ * Same hash as _hash_bytes(), usable in constant expressions
+ */
+constexpr std::size_t _hash_bytes_ce(const char* __str, std::size_t _bytes, std::size_t hash = 5381)
+{
+    return _bytes == 0 ? hash :
+                         _hash_bytes_ce(__str + 1, _bytes - 1,
+                                        ((hash << 5) + hash) + static_cast<std::size_t>(static_cast<int>(*__str)) );
+}
+
 /**
  * Represent a keys in the json string
  */
@@ -57,22 +69,24 @@ struct key
 {
     bool operator== (const key &k1) const
     {
-        std::size_t min =  std::min( k1._bytes, _bytes );
-        return ( memcmp(k1._ptr, _ptr, min) == 0 );
+        return ( k1._bytes == _bytes && memcmp(k1._ptr, _ptr, _bytes) == 0 );
     }
 
     key():
         _ptr(nullptr),
-        _bytes(0)
+        _bytes(0),
+        _hash(0)
     {}
 
     key(const key& k):
         _ptr(k._ptr),
-        _bytes(k._bytes)
+        _bytes(k._bytes),
+        _hash(k._hash)
     {}
 
     const char * _ptr;
     std::size_t _bytes;
+    std::size_t _hash;  // precomputed _hash_bytes() value, 0 if unknown
 };
 
 /**
@@ -82,10 +96,70 @@ struct key_hash
 {
     std::size_t operator()( key const &__val) const
     {
-        return _hash_bytes(__val._ptr , __val._bytes);
+        return __val._hash ? __val._hash : _hash_bytes(__val._ptr , __val._bytes);
+    }
+};
+
+/**
+ * Member name with its length and hash computed once, to look up the same
+ * name in many objects without hashing it again.
+ * From a string literal everything is computed at compile time:
+ *
+ *      constexpr jsonpack::key_handle price("price");
+ *      object.find(price);
+ *
+ * The handle does not own the name, it must outlive the handle and be
+ * null-terminated to appear in error messages.
+ */
+struct key_handle
+{
+    template<std::size_t N>
+    constexpr key_handle(const char (&name)[N]):
+        _ptr(name),
+        _bytes(N - 1),
+        _hash( _hash_bytes_ce(name, N - 1) )
+    {}
+
+    key_handle(const char* name, const std::size_t &bytes):
+        _ptr(name),
+        _bytes(bytes),
+        _hash( _hash_bytes(name, bytes) )
+    {}
+
+    explicit key_handle(const std::string &name):
+        _ptr(name.c_str()),
+        _bytes(name.length()),
+        _hash( _hash_bytes(name.data(), name.length()) )
+    {}
+
+    operator key() const
+    {
+        key k;
+        k._ptr = _ptr;
+        k._bytes = _bytes;
+        k._hash = _hash;
+        return k;
     }
+
+    const char * _ptr;
+    std::size_t _bytes;
+    std::size_t _hash;
 };
 
+/**
+ * One handle per name of the filter, pointing to the filter strings
+ */
+inline std::vector<key_handle> make_key_handles(const key_filter &filter)
+{
+    std::vector<key_handle> handles;
+    handles.reserve(filter._names.size());
+
+    for(const auto &name : filter._names)
+        handles.push_back( key_handle(name) );
+
+    return handles;
+}
+
 /**
  * JSON tokens
  */
@@ -117,6 +191,7 @@ enum jsonpack_token_type : unsigned
 struct position
 {
     jsonpack_token_type _type;
+    bool _escaped;          // string literal contains at least one '\\' escape
     char* _pos;
     unsigned long _count;
 
@@ -124,6 +199,7 @@ struct position
     position& operator =(const position &rvalue)
     {
         _type = rvalue._type;
+        _escaped = rvalue._escaped;
         _pos = rvalue._pos;
         _count = rvalue._count;
         return *this;
@@ -131,6 +207,34 @@ struct position
 #endif
 };
 
+/**
+ * True for tokens holding a whole value: strings, numbers, booleans and null
+ */
+inline bool is_literal_token(const jsonpack_token_type &token)
+{
+    return( token == JTK_INTEGER ||
+            token == JTK_REAL ||
+            token == JTK_STRING_LITERAL ||
+            token == JTK_TRUE ||
+            token == JTK_FALSE ||
+            token == JTK_NULL );
+}
+
+/**
+ * Position of the literal token tk just scanned by s, without the quotes
+ * of string literals
+ */
+inline position literal_position(const scanner &s, const jsonpack_token_type &tk)
+{
+    bool is_str = (tk == JTK_STRING_LITERAL);
+    position pos;
+    pos._pos = const_cast<char*>(s._source + (s._start_token_pos + is_str));
+    pos._count = s._i - s._start_token_pos - 2*is_str;
+    pos._type = tk;
+    pos._escaped = is_str && s._escaped;
+    return pos;
+}
+
 /**
  * Forward
  */
@@ -157,97 +261,127 @@ enum fields
     _NULL
 };
 
+/**
+ * Iterable view over the members of an object value. Each element is a
+ * std::pair<const key, value>: the name is a view into the JSON string,
+ * nothing is copied or allocated.
+ */
+struct member_range
+{
+    object_t::const_iterator begin() const
+    { return _begin; }
+
+    object_t::const_iterator end() const
+    { return _end; }
+
+    std::size_t size() const
+    { return std::distance(_begin, _end); }
+
+    object_t::const_iterator _begin;
+    object_t::const_iterator _end;
+};
+
+struct value;
+
 TYPE_BEGIN_NAMESPACE
 template<typename T, typename>
 struct json_extract_traits;
+
+template<typename T>
+bool try_extract(const value &v, char* json_ptr, T &out, error &err) noexcept;
 JSONPACK_API_END_NAMESPACE //type
 
 /**
- * Represent a JSON value. The union wrapper can represents a:
- * - position of: integer, real, UTF-8 string, boolean or null
+ * Represent a JSON value in two words. The union holds a:
+ * - pointer to the text of: integer, real, UTF-8 string, boolean or null,
+ *   or of a whole object/array left unparsed (token JTK_OPEN_KEY or
+ *   JTK_OPEN_BRACKET, see key_filter::_raw)
  * - an array_t
  * - an object_t
+ * and _meta packs the active field, the literal token type, the escaped
+ * flag and the text length (see meta_* constants).
+ * A value is the only owner of its object_t or array_t: it can be moved
+ * but copies must be explicit, see clone() and shared_value. A borrowed
+ * value (see borrow()) is a view of a container owned elsewhere, it is
+ * copied on the first change (see detach()).
  */
 struct value
 {
+    /**
+     * _meta layout: | length (56 bits) | escaped (1) | token (5) | field (2) |
+     * Containers use the escaped bit as the borrowed flag.
+     */
+    static const unsigned meta_token_shift = 2;
+    static const unsigned meta_escaped_shift = 7;
+    static const unsigned meta_length_shift = 8;
+    static const uint64_t meta_borrowed = 1u << meta_escaped_shift;
+
     /**
      * Constructors
      */
-    value() :_field(_NULL),_obj_ptr_count(0),_arr_ptr_count(0)
+    value() :_ptr(nullptr),_meta(_NULL)
     {}
 
-    value(position p) :_field(_POS),_obj_ptr_count(0),_arr_ptr_count(0)
-    { _pos = p; }
+    value(const position &p) :_ptr(p._pos),_meta(pack(p))
+    {}
 
-    value(object_t* o) :_field(_OBJ),_obj_ptr_count(1),_arr_ptr_count(0)
-    { _obj = o;}
+    value(object_t* o) :_obj(o),_meta(_OBJ)
+    {}
 
-    value(array_t* a) :_field(_ARR),_obj_ptr_count(0),_arr_ptr_count(1)
-    { _arr = a;}
+    value(array_t* a) :_arr(a),_meta(_ARR)
+    {}
 
     /**
-     * Copy constructor
+     * Not copyable: use clone() for a deep copy or shared_value for
+     * shared ownership
      */
-    value (const value &rv) :_field(_NULL),_obj_ptr_count(0),_arr_ptr_count(0)
-    {
-        switch (rv._field)
-        {
-        case _POS:
-            _pos = rv._pos;
-            break;
-        case _ARR:
-            _arr = rv._arr;
-            _arr_ptr_count = rv._arr_ptr_count;
-            rv._arr_ptr_count++;
-            break;
-        case _OBJ:
-            _obj = rv._obj;
-            _obj_ptr_count = rv._obj_ptr_count;
-            rv._obj_ptr_count++;
-        default:
-            break;
-        }
+    value (const value &rv) = delete;
 
-        _field = rv._field;
+    /**
+     * Move constructor, rv is left null
+     */
+    value (value &&rv) noexcept :_ptr(rv._ptr),_meta(rv._meta)
+    {
+        rv._ptr = nullptr;
+        rv._meta = _NULL;
     }
 
-
     /**
-     * Move constructor
+     * Deep copy, always owned
      */
-    value (value &&rv) :_field(_NULL),_obj_ptr_count(0),_arr_ptr_count(0)
+    value clone() const
     {
-        switch (rv._field)
+        if(field() == _OBJ)
+        {
+            value copy(new object_t(_obj->bucket_count()));
+            for(const auto &member : *_obj)
+                copy._obj->emplace(member.first, member.second.clone());
+            return copy;
+        }
+
+        if(field() == _ARR)
         {
-        case _POS:
-            _pos = std::move(rv._pos);
-            break;
-        case _ARR:
-            _arr = std::move(rv._arr);
-            _arr_ptr_count = std::move(rv._arr_ptr_count);
-            rv._arr_ptr_count++;
-            break;
-        case _OBJ:
-            _obj = rv._obj;
-            _obj_ptr_count = std::move(rv._obj_ptr_count);
-            rv._obj_ptr_count++;
-        default:
-            break;
+            value copy(new array_t());
+            copy._arr->reserve(_arr->size());
+            for(const auto &item : *_arr)
+                copy._arr->push_back(item.clone());
+            return copy;
         }
 
-        _field = std::move(rv._field);
+        value copy;
+        copy._ptr = _ptr;
+        copy._meta = _meta;
+        return copy;
     }
 
     /**
-     * Assignment operators
+     * Assignment operators, containers given by pointer are owned
      */
     value& operator =(object_t* o)
     {
         cleanup();
-        _field = _OBJ;
         _obj = o;
-        _obj_ptr_count++;
-
+        _meta = _OBJ;
 
         return *this;
     }
@@ -255,36 +389,29 @@ struct value
     value& operator =(array_t* a)
     {
         cleanup();
-        _field = _ARR;
         _arr = a;
-        _arr_ptr_count++;
+        _meta = _ARR;
 
         return *this;
     }
 
-    value& operator =(value &rv)
-    {
-        cleanup();
+    value& operator =(const value &rv) = delete;
 
-        switch (rv._field)
+    value& operator =(value &&rv) noexcept
+    {
+        if(this != &rv)
         {
-        case _POS:
-            _pos = rv._pos;
-            break;
-        case _ARR:
-            _arr = rv._arr;
-            _arr_ptr_count = rv._arr_ptr_count;
-            rv._arr_ptr_count++;
-            break;
-        case _OBJ:
-            _obj = rv._obj;
-            _obj_ptr_count = rv._obj_ptr_count;
-            rv._obj_ptr_count++;
-        default:
-            break;
+            // rv may live inside this value, e.g. v = std::move(v["a"]):
+            // take it before the old content is freed
+            char* ptr = rv._ptr;
+            uint64_t meta = rv._meta;
+            rv._ptr = nullptr;
+            rv._meta = _NULL;
+
+            cleanup();
+            _ptr = ptr;
+            _meta = meta;
         }
-        _field = rv._field;
-
         return *this;
     }
 
@@ -293,63 +420,83 @@ struct value
      */
     ~value()
     {
-        switch (_field)
-        {
-        case _ARR:
-            if(--_arr_ptr_count == 0) //i am the last owner
-            {
-                delete _arr;
-                _arr = nullptr;
-            }
-            break;
-        case _OBJ:
-            if(--_obj_ptr_count == 0)
-            {
-                delete _obj;
-                _obj = nullptr;
-            }
-        default:
-            break;
-        }
+        cleanup();
     }
 
-    void cleanup()
+    /**
+     * Release the owned container, the value becomes null
+     */
+    void cleanup() noexcept
     {
-        if(is_object())
-        {
+        if(field() == _OBJ && !borrowed())
             delete _obj;
-            _obj = nullptr;
-        }
-        else if(is_array())
-        {
+        else if(field() == _ARR && !borrowed())
             delete _arr;
-            _arr = nullptr;
-        }
+
+        _ptr = nullptr;
+        _meta = _NULL;
+    }
+
+    /**
+     * Field access
+     */
+    fields field() const
+    { return static_cast<fields>(_meta & 0x3); }
+
+    /**
+     * Token type of a literal, only meaningful when field() == _POS
+     */
+    jsonpack_token_type token() const
+    { return static_cast<jsonpack_token_type>( (_meta >> meta_token_shift) & 0x1F ); }
+
+    bool escaped() const
+    { return ( (_meta >> meta_escaped_shift) & 0x1 ) != 0; }
+
+    bool borrowed() const
+    { return field() != _POS && (_meta & meta_borrowed) != 0; }
+
+    char* data() const
+    { return _ptr; }
+
+    std::size_t length() const
+    { return static_cast<std::size_t>(_meta >> meta_length_shift); }
+
+    /**
+     * Position of a literal in the JSON string
+     */
+    position pos() const
+    {
+        position p;
+        p._type = token();
+        p._escaped = escaped();
+        p._pos = _ptr;
+        p._count = static_cast<unsigned long>( length() );
+        return p;
     }
 
     /**
      * Type check
      */
     bool is_null() const
-    { return (_field == _NULL || (_field == _POS && _pos._type == JTK_NULL ) ); }
+    { return (field() == _NULL || (field() == _POS && token() == JTK_NULL ) ); }
 
     bool is_boolean() const
-    { return (_field == _POS && ( _pos._type == JTK_TRUE || _pos._type == JTK_FALSE ) ); }
+    { return (field() == _POS && ( token() == JTK_TRUE || token() == JTK_FALSE ) ); }
 
     bool is_integer() const
-    { return (_field == _POS && _pos._type == JTK_INTEGER ); }
+    { return (field() == _POS && token() == JTK_INTEGER ); }
 
     bool is_real() const
-    { return (_field == _POS && _pos._type == JTK_REAL ); }
+    { return (field() == _POS && token() == JTK_REAL ); }
 
     bool is_string() const
-    { return (_field == _POS && _pos._type == JTK_STRING_LITERAL ); }
+    { return (field() == _POS && token() == JTK_STRING_LITERAL ); }
 
     bool is_object() const
-    { return (_field == _OBJ); }
+    { return (field() == _OBJ); }
 
     bool is_array() const
-    { return (_field == _ARR); }
+    { return (field() == _ARR); }
 
     /**
      * Explicit type conversion between current JSON value
@@ -361,11 +508,27 @@ struct value
           ! std::is_pointer<T>::value
           ,int>::type* = nullptr ) const
     {
-        T  _val;
-        type::json_extract_traits<T&, void>::extract(*this, nullptr, _val);
+        T  _val = T();
+        error err = try_get(_val);
+        if( !err.ok() )
+            err.raise();
         return _val;
     }
 
+    /**
+     * Non-throwing get, _val is unspecified on failure
+     */
+    template<typename T>
+    error try_get(T &_val) const noexcept
+    {
+        error err;
+        if( !type::json_extract_traits<T&, void>::match_token_type(*this) )
+            err.set(JERR_TYPE_MISMATCH, error::npos);
+        else
+            type::try_extract(*this, nullptr, _val, err);
+        return err;
+    }
+
 
     /**
      * Explicit type conversion between the current json value
@@ -377,7 +540,7 @@ struct value
                     ! std::is_pointer<T>::value
                     ,int>::type* = nullptr)
     {
-        if(_field == _POS && !json_traits<T&>::match_token_type(*this) )
+        if(field() == _POS && !json_traits<T&>::match_token_type(*this) )
             throw type_error("Types mismatch");
 
         type::json_extract_traits<T&,void>::extract(*this, nullptr, _val);
@@ -385,9 +548,9 @@ struct value
 
     std::size_t size() const
     {
-        if(_field == _ARR)
+        if(field() == _ARR)
             return _arr->size();
-        else if(_field == _OBJ)
+        else if(field() == _OBJ)
             return _obj->size();
 
         throw type_error("size must be used with array or object");
@@ -401,7 +564,8 @@ struct value
      */
     value& operator[](const std::string &__str_key)
     {
-        if(_field != _OBJ) throw type_error("current value is not an object!");
+        if(field() != _OBJ) throw type_error("current value is not an object!");
+        detach();
 
         key obj_key;
         obj_key._ptr = __str_key.c_str();
@@ -410,11 +574,54 @@ struct value
         return _obj->operator [](obj_key);
     }
 
+    template<std::size_t N>
+    value& operator[](const char (&__key)[N])
+    {
+        return operator[]( key_handle(__key) );
+    }
+
+    value& operator[](const key_handle &__key)
+    {
+        if(field() != _OBJ) throw type_error("current value is not an object!");
+        detach();
+
+        return _obj->operator [](__key);
+    }
+
+    /**
+     * Member lookup without insertion, nullptr if not found
+     */
+    const value* find(const key_handle &__key) const
+    {
+        if(field() != _OBJ) throw type_error("current value is not an object!");
+
+        object_t::const_iterator found = _obj->find(__key);
+        return found != _obj->end() ? &found->second : nullptr;
+    }
+
+    /**
+     * Read-only navigation, never inserts: safe on values shared between threads
+     */
+    const value& at(const key_handle &__key) const
+    {
+        const value *found = find(__key);
+        if(found == nullptr) throw jsonpack_error("member not found");
+        return *found;
+    }
+
+    const value& at(const std::size_t __index) const
+    {
+        if(field() != _ARR) throw type_error("current value is not an array!");
+        if(__index >= _arr->size()) throw jsonpack_error("index out of range");
+        return (*_arr)[__index];
+    }
+
     std::vector<std::string> members() const
     {
-        if(_field != _OBJ) throw type_error("current value is not an object!");
+        if(field() != _OBJ) throw type_error("current value is not an object!");
 
         std::vector<std::string> m;
+        m.reserve(_obj->size());
 
         for(object_t::iterator pair  = _obj->begin(); pair != _obj->end(); ++pair)
         {
@@ -430,100 +637,371 @@ struct value
     }
 
 
+    /**
+     * Iterate key/value pairs without copying the keys:
+     *
+     *      for(const auto &member : obj.items())
+     *          use(member.first._ptr, member.first._bytes, member.second);
+     */
+    member_range items() const
+    {
+        if(field() != _OBJ) throw type_error("current value is not an object!");
+
+        member_range range = { _obj->cbegin(), _obj->cend() };
+        return range;
+    }
+
     /**
      * Vector operations when json value is
      * ARRAY
      */
     value& operator[](const std::size_t __index)
     {
-        if(_field != _ARR) throw type_error("current value is not an array!");
+        if(field() != _ARR) throw type_error("current value is not an array!");
+        detach();
         return _arr->operator [](__index);
     }
 
 
     array_t::iterator begin()
     {
-        if(_field != _ARR) throw type_error("current value is not an array!");
+        if(field() != _ARR) throw type_error("current value is not an array!");
+        detach();
         return _arr->begin();
     }
 
     array_t::const_iterator begin() const
     {
-        if(_field != _ARR) throw type_error("current value is not an array!");
+        if(field() != _ARR) throw type_error("current value is not an array!");
         return _arr->begin();
     }
 
     array_t::iterator end()
     {
-        if(_field != _ARR) throw type_error("current value is not an array!");
+        if(field() != _ARR) throw type_error("current value is not an array!");
+        detach();
         return _arr->end();
     }
 
     array_t::const_iterator end() const
     {
-        if(_field != _ARR) throw type_error("current value is not an array!");
+        if(field() != _ARR) throw type_error("current value is not an array!");
         return _arr->end();
     }
 
     /**
-     * Create a json from value
+     * EDITING
+     * Changes go through the methods below, which detach() the container
+     * first: editing a borrowed tree copies only the containers on the path
+     * to the change. Text of new keys and literals is not copied, it must
+     * outlive the value (see draft).
      */
-    //    void append(buffer &json)
-    //    {
-    //        if( is_array() )
-    //            _arr->append(json);
-    //        else if(is_object())
-    //            _obj->append(json);
-    //        else if( is_string() )
-    //                util::json_builder::append_string(json, _pos._pos, _pos._count);
-    //        else
-    //        {
-    //            json.append(_pos._pos, _pos._count);
-    //            json.append(",", 1);
-    //        }
-    //    }
 
-    void json_unpack(const char* json, const std::size_t &len)
+    /**
+     * Non-owning view of v: containers are shared, literals copied. v must
+     * outlive the view and every view made from it.
+     */
+    static value borrow(const value &v)
     {
-        cleanup();
+        value view;
+        view._ptr = v._ptr;
+        view._meta = v._meta;
+        if(v.field() == _OBJ || v.field() == _ARR)
+            view._meta |= meta_borrowed;
+        return view;
+    }
+
+    /**
+     * Make a borrowed container owned by copying its first level, the items
+     * of the copy borrow the original ones. No-op on other values.
+     */
+    void detach()
+    {
+        if(!borrowed())
+            return;
+
+        if(field() == _OBJ)
+        {
+            std::unique_ptr<object_t> copy(new object_t(_obj->bucket_count()));
+            for(const auto &member : *_obj)
+                copy->emplace(member.first, borrow(member.second));
+            _obj = copy.release();
+            _meta = _OBJ;
+        }
+        else
+        {
+            std::unique_ptr<array_t> copy(new array_t());
+            copy->reserve(_arr->size() + 1);
+            for(const auto &item : *_arr)
+                copy->push_back(borrow(item));
+            _arr = copy.release();
+            _meta = _ARR;
+        }
+    }
+
+    /**
+     * Insert or replace the member __key, returns it
+     */
+    value& set(const key &__key, value &&v)
+    {
+        if(field() != _OBJ) throw type_error("current value is not an object!");
+        detach();
 
-        parser _p;
+        value &member = _obj->operator [](__key);
+        member = std::move(v);
+        return member;
+    }
 
-        if(*json == '[')
+    /**
+     * Remove the member __key, false if there was none
+     */
+    bool erase(const key_handle &__key)
+    {
+        if(field() != _OBJ) throw type_error("current value is not an object!");
+        if(find(__key) == nullptr)
+            return false;
+
+        detach();
+        return _obj->erase(__key) != 0;
+    }
+
+    value& push_back(value &&v)
+    {
+        if(field() != _ARR) throw type_error("current value is not an array!");
+        detach();
+
+        _arr->push_back(std::move(v));
+        return _arr->back();
+    }
+
+    /**
+     * Insert before __index, size() appends
+     */
+    value& insert(const std::size_t __index, value &&v)
+    {
+        if(field() != _ARR) throw type_error("current value is not an array!");
+        if(__index > _arr->size()) throw jsonpack_error("index out of range");
+        detach();
+
+        return *_arr->insert(_arr->begin() + __index, std::move(v));
+    }
+
+    void erase(const std::size_t __index)
+    {
+        if(field() != _ARR) throw type_error("current value is not an array!");
+        if(__index >= _arr->size()) throw jsonpack_error("index out of range");
+        detach();
+
+        _arr->erase(_arr->begin() + __index);
+    }
+
+    /**
+     * Existing member or item to be changed, this container is detached.
+     * Unlike operator[] nothing is inserted.
+     */
+    value& edit(const key_handle &__key)
+    {
+        at(__key);
+        detach();
+        return _obj->find(__key)->second;
+    }
+
+    value& edit(const std::size_t __index)
+    {
+        at(__index);
+        detach();
+        return (*_arr)[__index];
+    }
+
+    /**
+     * Write the value as JSON followed by ',', like json_traits::append.
+     * Literals are copied verbatim from the parsed text: escapes and number
+     * spelling are kept, nothing is re-encoded. Members are written in hash
+     * table order.
+     */
+    void append(buffer &json, const bool &pretty = false, const unsigned &indent = 1, unsigned level = 0) const
+    {
+        if(field() == _POS)
+        {
+            if(token() == JTK_STRING_LITERAL)
+            {
+                json.append("\"", 1);
+                json.append_large(_ptr, length());
+                json.append("\",", 2);
+            }
+            else
+            {
+                json.append_large(_ptr, length());
+                json.append(",", 1);
+            }
+        }
+        else if(field() == _OBJ)
         {
-            _field = _ARR;
-            _arr = new array_t();
-            _arr_ptr_count = 1;
+            json.append("{", 1);
+            for(const auto &member : *_obj)
+            {
+                if(pretty)
+                    new_line(json, indent, level + 1);
 
-            if(!_p.json_validate(json, len, *_arr))
-                throw invalid_json( _p.err_msg().c_str() );
+                json.append("\"", 1);
+                json.append(member.first._ptr, member.first._bytes);
+                json.append("\":", 2);
+                member.second.append(json, pretty, indent, level + 1);
+            }
+            close(json, "},", pretty && !_obj->empty(), indent, level);
         }
-        else if(*json == '{')
+        else if(field() == _ARR)
         {
-            _field = _OBJ;
-            _obj = new object_t(16);
-            _obj_ptr_count = 1;
+            json.append("[", 1);
+            for(const auto &item : *_arr)
+            {
+                if(pretty)
+                    new_line(json, indent, level + 1);
 
-            if(!_p.json_validate(json, len, *_obj))
-                throw invalid_json( _p.err_msg().c_str() );
+                item.append(json, pretty, indent, level + 1);
+            }
+            close(json, "],", pretty && !_arr->empty(), indent, level);
         }
         else
-            throw invalid_json("JSON must be object or array");
+        {
+            json.append("null,", 5);
+        }
+    }
+
+    /**
+     * Serialize the value, the caller must free() the result
+     */
+    char* json_pack(const bool &pretty = false, const unsigned &indent = 1) const
+    {
+        buffer json;
+        json_pack(json, pretty, indent);
+        return json.release();
     }
 
-    fields _field;
+    /**
+     * Append the JSON text to a caller's buffer or string
+     */
+    void json_pack(buffer &json, const bool &pretty = false, const unsigned &indent = 1) const
+    {
+        append(json, pretty, indent);
+        json.erase_last_comma();
+    }
+
+    void json_pack(std::string &out, const bool &pretty = false, const unsigned &indent = 1) const
+    {
+        buffer json(out);
+        json_pack(json, pretty, indent);
+    }
+
+    /**
+     * Serialize into out[0, capacity), e.g. a stack array. Returns the
+     * length of the JSON text, which was written and null-terminated only
+     * if it is less than capacity. See also json_pack_exact().
+     */
+    std::size_t json_pack(char* out, const std::size_t &capacity,
+                          const bool &pretty = false, const unsigned &indent = 1) const
+    {
+        buffer json(out, capacity);
+        json_pack(json, pretty, indent);
+        json.append("\0", 1);
+        return json.size() - 1;
+    }
+
+    void json_unpack(const char* json, const std::size_t &len)
+    {
+        error err = try_json_unpack(json, len);
+        if( !err.ok() )
+            err.raise();
+    }
+
+    /**
+     * Non-throwing json_unpack, the value is left null on failure
+     */
+    error try_json_unpack(const char* json, const std::size_t &len) noexcept
+    {
+        cleanup();
+
+        error err;
+        if(len == 0)
+            err.set(JERR_EMPTY, 0);
+        else if(*json != '[' && *json != '{')
+            err.set(JERR_NOT_CONTAINER, 0);
+        else
+        {
+            try
+            {
+                parser _p;
+                bool valid;
+
+                if(*json == '[')
+                {
+                    *this = new array_t();
+                    valid = _p.try_validate(json, len, *_arr, err);
+                }
+                else
+                {
+                    *this = new object_t(16);
+                    valid = _p.try_validate(json, len, *_obj, err);
+                }
+
+                if(!valid)
+                    cleanup();
+            }
+            catch(const std::bad_alloc&)
+            {
+                err.set(JERR_ALLOC, error::npos);
+            }
+        }
+        return err;
+    }
+
+    static void new_line(buffer &json, const unsigned &indent, const unsigned &level)
+    {
+        json.append("\n", 1);
+        json.append(' ', indent * level);
+    }
+
+    static void close(buffer &json, const char *token, const bool &pretty, const unsigned &indent, const unsigned &level)
+    {
+        json.erase_last_comma();
+        if(pretty)
+            new_line(json, indent, level);
+        json.append(token, 2);
+    }
+
+    static uint64_t pack(const position &p)
+    {
+        return static_cast<uint64_t>(_POS) |
+               ( static_cast<uint64_t>(p._type) << meta_token_shift ) |
+               ( static_cast<uint64_t>(p._escaped) << meta_escaped_shift ) |
+               ( static_cast<uint64_t>(p._count) << meta_length_shift );
+    }
 
     union
     {
-        position   _pos;
+        char*      _ptr;
         object_t*  _obj;
         array_t*   _arr;
     };
 
-    mutable unsigned _obj_ptr_count;
-    mutable unsigned _arr_ptr_count;
+    uint64_t _meta;
 };
 
+static_assert(sizeof(void*) != 8 || sizeof(value) == 16, "jsonpack::value must fit in two words");
+
+/**
+ * Shared read-only ownership of a DOM, e.g. to hand a parsed document to
+ * several consumers:
+ *
+ *      jsonpack::shared_value doc = jsonpack::share(std::move(v));
+ */
+typedef std::shared_ptr<const value> shared_value;
+
+inline shared_value share(value &&v)
+{
+    return std::make_shared<const value>( std::move(v) );
+}
+
 
 
 JSONPACK_API_END_NAMESPACE
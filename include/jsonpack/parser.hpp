@@ -20,12 +20,14 @@
 #define JSONPACK_JSON_PARSER
 
 #include <cctype>
+#include <cstring>
 #include <stdint.h>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
 #include "jsonpack/namespace.hpp"
+#include "jsonpack/error.hpp"
 
 JSONPACK_API_BEGIN_NAMESPACE
 
@@ -59,7 +61,9 @@ struct scanner
         _i(0),
         _size(0),
         _start_token_pos(0),
-        _c('\0')
+        _c('\0'),
+        _escaped(false),
+        _error(JERR_NONE)
     {}
 
     scanner(const scanner &s):
@@ -67,7 +71,9 @@ struct scanner
         _i(s._i),
         _size(s._size),
         _start_token_pos(s._start_token_pos),
-        _c(s._c)
+        _c(s._c),
+        _escaped(s._escaped),
+        _error(s._error)
     {}
 
     ~scanner()
@@ -81,7 +87,10 @@ struct scanner
         return *this;
     }
 
-    void init(const char *json, const std::size_t &len);
+    /**
+     * Returns false on an empty input, next() then gives JTK_EOF
+     */
+    bool init(const char *json, const std::size_t &len);
 
     void advance();
 
@@ -110,6 +119,25 @@ struct scanner
      */
     key get_last_key(bool expect_str_literal);
 
+    /**
+     * Skip the rest of an object or array opened by open, stopping after
+     * its matching close: right after the open token, or after_item once
+     * some of its items were consumed. The text is validated like the
+     * parser does (tokens, grammar, bracket kinds), no DOM node is built.
+     */
+    bool skip_container(const jsonpack_token_type &open, const bool &after_item = false);
+
+    /**
+     * Record why the current token is invalid, nothing is thrown
+     */
+    jsonpack_token_type fail(const error_code &code);
+
+    /**
+     * Fill err the way the parser reports a failure: the scanner's own
+     * error where it stopped, else code at the current token. Returns false.
+     */
+    bool report(error &err, const error_code &code) const;
+
     //disabling warning on GNU
 #ifndef _MSC_VER
     const char * _source = nullptr;
@@ -119,6 +147,10 @@ struct scanner
     uint_fast32_t _start_token_pos = 0;
 
     char _c = '\0';
+
+    bool _escaped = false;  // last string literal had escapes
+
+    error_code _error = JERR_NONE;  // set with JTK_INVALID
 #else
     const char * _source ;
     uint_fast32_t _i ;
@@ -127,10 +159,58 @@ struct scanner
     uint_fast32_t _start_token_pos ;
 
     char _c;
+
+    bool _escaped;
+
+    error_code _error;
 #endif
 
 };
 
+/** ****************************************************************************
+ ******************************** KEY FILTER ***********************************
+ *******************************************************************************/
+
+/**
+ * Member names the caller is interested in. When given to the parser,
+ * the values of any other top level member are skipped instead of parsed.
+ * Objects and arrays of members marked raw are not parsed either, the
+ * parser keeps the slice of their text (see raw_json).
+ */
+struct key_filter
+{
+    static const std::size_t npos = static_cast<std::size_t>(-1);
+
+    key_filter():
+        _names(),
+        _raw()
+    {}
+
+    /**
+     * Build from a comma separated list of names, e.g: "id,name,tags"
+     */
+    explicit key_filter(const std::string &names);
+
+    /**
+     * Index of name in _names, npos if rejected
+     */
+    std::size_t find(const char *name, const std::size_t &len) const
+    {
+        for(std::size_t i = 0; i < _names.size(); ++i)
+        {
+            if(_names[i].length() == len && memcmp(_names[i].data(), name, len) == 0)
+                return i;
+        }
+        return npos;
+    }
+
+    bool accept(const char *name, const std::size_t &len) const
+    { return find(name, len) != npos; }
+
+    std::vector<std::string> _names;
+    std::vector<bool> _raw;             // parallel to _names
+};
+
 /** ****************************************************************************
  ******************************** PARSER ***************************************
  *******************************************************************************/
@@ -147,21 +227,56 @@ struct parser
      */
     parser(const parser &p);
 
+    /**
+     * Build the DOM of json, throws invalid_json on syntax errors
+     */
     bool json_validate(const char *json, const std::size_t &len, object_t &members);
+
+    /**
+     * Same as above but top level members rejected by the filter are
+     * skipped without building their values
+     */
+    bool json_validate(const char *json, const std::size_t &len, object_t &members, const key_filter &filter);
     bool json_validate(const char *json,const std::size_t &len, array_t &elemets );
 
+    /**
+     * Non-throwing versions: on failure they return false and err holds
+     * the code and byte offset. Meant for untrusted input where malformed
+     * documents are frequent.
+     */
+    bool try_validate(const char *json, const std::size_t &len, object_t &members, error &err,
+                      const key_filter *filter = nullptr) noexcept;
+    bool try_validate(const char *json, const std::size_t &len, array_t &elemets, error &err) noexcept;
+
+    const error& last_error() const
+    { return _error; }
+
     std::string err_msg();
 
 private:
+    bool validate(const char *json, const std::size_t &len, object_t &members, const key_filter *filter);
+
+    bool validate(const char *json, const std::size_t &len, array_t &elemets);
+
+    /**
+     * Record a syntax error at the current position, an error found by the
+     * scanner on the current token takes precedence. Returns false.
+     */
+    bool fail(const error_code &code);
+
     bool match(const jsonpack_token_type &token);
 
 	bool is_literal(const jsonpack_token_type &token);
 
     void advance();
 
-    bool item_list(object_t &members);
+    bool item_list(object_t &members, const key_filter *filter = nullptr);
+
+    bool item(object_t &members, const key_filter *filter);
+
+    bool skip_value();
 
-    bool item(object_t &members);
+    bool raw_value(key k, object_t &members);
 
     bool value(key k, object_t &members);
 
@@ -172,6 +287,7 @@ private:
 
     jsonpack_token_type _tk;
     scanner _s;
+    error _error;
 };
 
 JSONPACK_API_END_NAMESPACE
@@ -0,0 +1,148 @@
+/**
+ *  Jsonpack - Compiled JSON Pointer queries
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_PATH_HPP
+#define JSONPACK_PATH_HPP
+
+#include <string>
+#include <vector>
+
+#include "jsonpack/types.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+/**
+ * JSON Pointer (RFC 6901) compiled once and evaluated many times,
+ * e.g: "/store/book/0/title". A "*" segment matches every member of an
+ * object or every item of an array. Member names are compared once their
+ * escapes are decoded, and a name repeated in an object refers to its last
+ * member, as object_t keeps it.
+ * Member hashes and array indexes are computed in the constructor, so
+ * evaluation does no hashing of the path and no string building.
+ */
+class path
+{
+public:
+    /**
+     * Compile a pointer, "" is the whole document
+     */
+    explicit path(const std::string &pointer);
+
+    /**
+     * DOM evaluation, returns the first matching value or nullptr
+     */
+    const value* find(const value &root) const;
+
+    /**
+     * DOM evaluation, collects every matching value (array items in order,
+     * object members in hash table order)
+     */
+    void find_all(const value &root, std::vector<const value*> &out) const;
+
+    /**
+     * Raw text evaluation: the document is scanned once, values off the
+     * path are skipped and no DOM is built. Objects and arrays are returned
+     * as the text slice from the open to the close token (types JTK_OPEN_KEY
+     * and JTK_OPEN_BRACKET). The whole value is scanned, since a later
+     * member may replace the one matched; text after it is not looked at.
+     */
+    bool find(const char *json, const std::size_t &len, position &out) const;
+
+    /**
+     * Raw text evaluation, collects every match in document order
+     */
+    void find_all(const char *json, const std::size_t &len, std::vector<position> &out) const;
+
+    /**
+     * Typed lookup, returns false when nothing matches
+     */
+    template<typename T>
+    bool get(const value &root, T &out) const
+    {
+        const value *v = find(root);
+        if(v == nullptr)
+            return false;
+
+        extract(*v, out);
+        return true;
+    }
+
+    template<typename T>
+    bool get(const char *json, const std::size_t &len, T &out) const
+    {
+        position p;
+        if( !find(json, len, p) )
+            return false;
+
+        if(p._type == JTK_OPEN_KEY || p._type == JTK_OPEN_BRACKET)
+        {
+            value v;
+            v.json_unpack(p._pos, p._count);
+            extract(v, out);
+        }
+        else
+        {
+            extract(value(p), out);
+        }
+        return true;
+    }
+
+    std::size_t size() const
+    {
+        return _segments.size();
+    }
+
+private:
+    struct segment
+    {
+        segment():
+            _name(),
+            _hash(0),
+            _index(std::string::npos),
+            _wildcard(false)
+        {}
+
+        std::string _name;
+        std::size_t _hash;
+        std::size_t _index;     // std::string::npos if not an array index
+        bool _wildcard;
+    };
+
+    template<typename T>
+    static void extract(const value &v, T &out)
+    {
+        if( !type::json_extract_traits<T&, void>::match_token_type(v) )
+            throw type_error("Types mismatch");
+
+        type::json_extract_traits<T&, void>::extract(v, nullptr, out);
+    }
+
+    const value* lookup(const value &v, std::size_t seg) const;
+
+    void collect(const value &v, std::size_t seg, std::vector<const value*> &out) const;
+
+    const value* member(const value &v, const segment &s) const;
+
+    void walk(scanner &s, jsonpack_token_type tk, std::size_t seg, std::vector<position> &out) const;
+
+    std::vector<segment> _segments;
+};
+
+JSONPACK_API_END_NAMESPACE
+
+#endif // JSONPACK_PATH_HPP
@@ -0,0 +1,160 @@
+/**
+ *  Jsonpack - Per-thread pool of output buffers
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_POOL_HPP
+#define JSONPACK_POOL_HPP
+
+#include <string>
+#include <utility>
+
+#include "jsonpack/buffer.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+/**
+ * Free list of output blocks kept by each thread. Blocks are malloc'd, a
+ * block released on another thread joins that thread's list. Blocks
+ * beyond max_blocks or larger than max_block_size are freed.
+ */
+struct buffer_pool
+{
+    static const std::size_t max_blocks = 8;
+    static const std::size_t max_block_size = 1 << 20;
+
+    /**
+     * A block of this thread's list, or a new one of 8 KB
+     */
+    static char* acquire(std::size_t &alloc);
+
+    static void recycle(char* data, const std::size_t &alloc) noexcept;
+
+    /**
+     * Blocks held by the calling thread
+     */
+    static std::size_t cached();
+
+    /**
+     * Free the blocks held by the calling thread
+     */
+    static void trim() noexcept;
+};
+
+/**
+ * JSON text in a block of the buffer pool, given back on destruction
+ * instead of freed. Loops packing one message at a time reuse the same
+ * block and do no malloc/free once it grew to the message size:
+ *
+ *      jsonpack::packed json = jsonpack::json_pack_pooled(msg);
+ *      send(json.data(), json.size());
+ *
+ * Not meant for static or thread_local storage: the pool of a thread is
+ * gone once the thread exits.
+ */
+class packed
+{
+public:
+    packed():
+        _data(nullptr),
+        _size(0),
+        _alloc(0)
+    {}
+
+    packed(packed &&p) noexcept:
+        _data(p._data),
+        _size(p._size),
+        _alloc(p._alloc)
+    {
+        p._data = nullptr;
+        p._size = 0;
+        p._alloc = 0;
+    }
+
+    packed& operator=(packed &&p) noexcept
+    {
+        if(this != &p)
+        {
+            reset();
+            std::swap(_data, p._data);
+            std::swap(_size, p._size);
+            std::swap(_alloc, p._alloc);
+        }
+        return *this;
+    }
+
+    ~packed()
+    {
+        reset();
+    }
+
+    /**
+     * Pack through fn(buffer&), which appends one JSON text
+     */
+    template<typename Fn>
+    static packed make(const Fn &fn)
+    {
+        buffer json(0);
+        std::size_t alloc = 0;
+        char* data = buffer_pool::acquire(alloc);
+        json.adopt(data, alloc);
+
+        fn(json);
+        json.append("\0", 1);
+
+        packed p;
+        p._size = json.size() - 1;
+        p._data = json.detach(p._alloc);
+        return p;
+    }
+
+    /**
+     * Null-terminated text
+     */
+    const char* data() const
+    { return _data; }
+
+    std::size_t size() const
+    { return _size; }
+
+    bool empty() const
+    { return _size == 0; }
+
+    std::string str() const
+    { return std::string(_data, _size); }
+
+    packed(const packed&) = delete;
+    packed& operator=(const packed&) = delete;
+
+private:
+    void reset() noexcept
+    {
+        if(_data != nullptr)
+            buffer_pool::recycle(_data, _alloc);
+
+        _data = nullptr;
+        _size = 0;
+        _alloc = 0;
+    }
+
+    char* _data;
+    std::size_t _size;
+    std::size_t _alloc;
+};
+
+JSONPACK_API_END_NAMESPACE
+
+#endif // JSONPACK_POOL_HPP
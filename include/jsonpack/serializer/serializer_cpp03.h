@@ -1237,6 +1237,1957 @@ static inline void make_object(const object_t &json_obj, char* json_ptr, const s
                 v17, v18, v19, v20, v21, v22, v23, v24,
                 v25, v26, v27, v28, v29, v30, v31);
 }
+
+////============================== MAKE_OBJECT (precomputed keys) ==============================
+// 1 parameter
+template <typename T>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+}
+
+// 2 parameters
+template <typename T, typename T1>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1);
+}
+
+// 3 parameters
+template <typename T, typename T1, typename T2>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2);
+}
+
+// 4 parameters
+template <typename T, typename T1, typename T2, typename T3>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3);
+}
+
+// 5 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4);
+}
+
+// 6 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5);
+}
+
+// 7 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6);
+}
+
+// 8 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7);
+}
+
+// 9 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8);
+}
+
+// 10 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9);
+}
+
+// 11 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10);
+}
+
+// 12 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11);
+}
+
+// 13 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12);
+}
+
+// 14 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13);
+}
+
+// 15 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14);
+}
+
+// 16 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15);
+}
+
+// 17 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16);
+}
+
+// 18 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17);
+}
+
+// 19 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18);
+}
+
+// 20 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19);
+}
+
+// 21 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20);
+}
+
+// 22 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21);
+}
+
+// 23 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22);
+}
+
+// 24 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22, v23);
+}
+
+// 25 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                               T24 &v24)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22, v23, v24);
+}
+
+// 26 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                               T24 &v24, T25 &v25)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22, v23, v24,
+                v25);
+}
+
+// 27 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                               T24 &v24, T25 &v25, T26 &v26)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22, v23, v24,
+                v25, v26);
+}
+
+// 28 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                               T24 &v24, T25 &v25, T26 &v26, T27 &v27)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22, v23, v24,
+                v25, v26, v27);
+}
+
+// 29 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                               T24 &v24, T25 &v25, T26 &v26, T27 &v27, T28 &v28)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22, v23, v24,
+                v25, v26, v27, v28);
+}
+
+// 30 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28, typename T29>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                               T24 &v24, T25 &v25, T26 &v26, T27 &v27, T28 &v28, T29 &v29)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22, v23, v24,
+                v25, v26, v27, v28, v29);
+}
+
+// 31 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28, typename T29, typename T30>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                               T24 &v24, T25 &v25, T26 &v26, T27 &v27, T28 &v28, T29 &v29, T30 &v30)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22, v23, v24,
+                v25, v26, v27, v28, v29, v30);
+}
+
+// 32 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28, typename T29, typename T30, typename T31>
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys,
+                               T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                               T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                               T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                               T24 &v24, T25 &v25, T26 &v26, T27 &v27, T28 &v28, T29 &v29, T30 &v30, T31 &v31)
+{
+    type::extract_member(json_obj, json_ptr, *keys, v);
+
+    make_object(json_obj, json_ptr, keys + 1,
+                v1, v2, v3, v4, v5, v6, v7, v8,
+                v9, v10, v11, v12, v13, v14, v15, v16,
+                v17, v18, v19, v20, v21, v22, v23, v24,
+                v25, v26, v27, v28, v29, v30, v31);
+}
+
+////============================== TRY_MAKE_OBJECT ==============================================
+/**
+ * Non-throwing make_object, stops at the first member that fails
+ */
+// 1 parameter
+template <typename T>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err);
+}
+
+// 2 parameters
+template <typename T, typename T1>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1);
+}
+
+// 3 parameters
+template <typename T, typename T1, typename T2>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2);
+}
+
+// 4 parameters
+template <typename T, typename T1, typename T2, typename T3>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3);
+}
+
+// 5 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4);
+}
+
+// 6 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5);
+}
+
+// 7 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6);
+}
+
+// 8 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7);
+}
+
+// 9 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8);
+}
+
+// 10 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9);
+}
+
+// 11 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10);
+}
+
+// 12 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11);
+}
+
+// 13 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12);
+}
+
+// 14 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13);
+}
+
+// 15 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14);
+}
+
+// 16 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15);
+}
+
+// 17 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16);
+}
+
+// 18 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17);
+}
+
+// 19 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18);
+}
+
+// 20 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19);
+}
+
+// 21 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20);
+}
+
+// 22 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21);
+}
+
+// 23 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22);
+}
+
+// 24 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22, v23);
+}
+
+// 25 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                                   T24 &v24)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22, v23, v24);
+}
+
+// 26 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                                   T24 &v24, T25 &v25)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22, v23, v24,
+                           v25);
+}
+
+// 27 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                                   T24 &v24, T25 &v25, T26 &v26)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22, v23, v24,
+                           v25, v26);
+}
+
+// 28 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                                   T24 &v24, T25 &v25, T26 &v26, T27 &v27)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22, v23, v24,
+                           v25, v26, v27);
+}
+
+// 29 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                                   T24 &v24, T25 &v25, T26 &v26, T27 &v27, T28 &v28)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22, v23, v24,
+                           v25, v26, v27, v28);
+}
+
+// 30 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28, typename T29>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                                   T24 &v24, T25 &v25, T26 &v26, T27 &v27, T28 &v28, T29 &v29)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22, v23, v24,
+                           v25, v26, v27, v28, v29);
+}
+
+// 31 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28, typename T29, typename T30>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                                   T24 &v24, T25 &v25, T26 &v26, T27 &v27, T28 &v28, T29 &v29, T30 &v30)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22, v23, v24,
+                           v25, v26, v27, v28, v29, v30);
+}
+
+// 32 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28, typename T29, typename T30, typename T31>
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &v, T1 &v1, T2 &v2, T3 &v3, T4 &v4, T5 &v5, T6 &v6, T7 &v7,
+                                   T8 &v8, T9 &v9, T10 &v10, T11 &v11, T12 &v12, T13 &v13, T14 &v14, T15 &v15,
+                                   T16 &v16, T17 &v17, T18 &v18, T19 &v19, T20 &v20, T21 &v21, T22 &v22, T23 &v23,
+                                   T24 &v24, T25 &v25, T26 &v26, T27 &v27, T28 &v28, T29 &v29, T30 &v30, T31 &v31)
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, v, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err,
+                           v1, v2, v3, v4, v5, v6, v7, v8,
+                           v9, v10, v11, v12, v13, v14, v15, v16,
+                           v17, v18, v19, v20, v21, v22, v23, v24,
+                           v25, v26, v27, v28, v29, v30, v31);
+}
+
+////============================== MARK_RAW ==============================================
+/**
+ * Flag the raw_json members in the filter built from their names, the
+ * values are only used for their type
+ */
+// 1 parameter
+template <typename T>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return filter;
+}
+
+// 2 parameters
+template <typename T, typename T1>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1);
+}
+
+// 3 parameters
+template <typename T, typename T1, typename T2>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2);
+}
+
+// 4 parameters
+template <typename T, typename T1, typename T2, typename T3>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3);
+}
+
+// 5 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4);
+}
+
+// 6 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5);
+}
+
+// 7 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6);
+}
+
+// 8 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7);
+}
+
+// 9 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8);
+}
+
+// 10 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9);
+}
+
+// 11 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10);
+}
+
+// 12 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11);
+}
+
+// 13 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12);
+}
+
+// 14 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13);
+}
+
+// 15 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14);
+}
+
+// 16 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15);
+}
+
+// 17 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16);
+}
+
+// 18 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17);
+}
+
+// 19 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18);
+}
+
+// 20 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19);
+}
+
+// 21 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20);
+}
+
+// 22 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21);
+}
+
+// 23 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22);
+}
+
+// 24 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22, v23);
+}
+
+// 25 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                  const T24 &v24)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22, v23, v24);
+}
+
+// 26 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                  const T24 &v24, const T25 &v25)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22, v23, v24,
+                    v25);
+}
+
+// 27 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                  const T24 &v24, const T25 &v25, const T26 &v26)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22, v23, v24,
+                    v25, v26);
+}
+
+// 28 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                  const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22, v23, v24,
+                    v25, v26, v27);
+}
+
+// 29 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                  const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27, const T28 &v28)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22, v23, v24,
+                    v25, v26, v27, v28);
+}
+
+// 30 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28, typename T29>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                  const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27, const T28 &v28, const T29 &v29)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22, v23, v24,
+                    v25, v26, v27, v28, v29);
+}
+
+// 31 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28, typename T29, typename T30>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                  const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27, const T28 &v28, const T29 &v29, const T30 &v30)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22, v23, v24,
+                    v25, v26, v27, v28, v29, v30);
+}
+
+// 32 parameters
+template <typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+          typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15,
+          typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22, typename T23,
+          typename T24, typename T25, typename T26, typename T27, typename T28, typename T29, typename T30, typename T31>
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index,
+                                  const T &, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                  const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                  const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                  const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27, const T28 &v28, const T29 &v29, const T30 &v30, const T31 &v31)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+    return mark_raw(filter, index + 1,
+                    v1, v2, v3, v4, v5, v6, v7, v8,
+                    v9, v10, v11, v12, v13, v14, v15, v16,
+                    v17, v18, v19, v20, v21, v22, v23, v24,
+                    v25, v26, v27, v28, v29, v30, v31);
+}
+
+////============================== VISIT_MEMBER ==============================================
+/**
+ * Call fn(key, value) for the member at index, e.g. to format the members
+ * one at a time
+ */
+// 1 parameter
+template <typename Fn, typename T>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v)
+{
+    if(index == 0)
+        fn(*keys, v);
+}
+
+// 2 parameters
+template <typename Fn, typename T, typename T1>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1);
+}
+
+// 3 parameters
+template <typename Fn, typename T, typename T1, typename T2>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2);
+}
+
+// 4 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3);
+}
+
+// 5 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4);
+}
+
+// 6 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5);
+}
+
+// 7 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6);
+}
+
+// 8 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7);
+}
+
+// 9 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8);
+}
+
+// 10 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9);
+}
+
+// 11 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10);
+}
+
+// 12 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11);
+}
+
+// 13 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12);
+}
+
+// 14 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13);
+}
+
+// 15 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14);
+}
+
+// 16 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15);
+}
+
+// 17 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16);
+}
+
+// 18 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17);
+}
+
+// 19 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18);
+}
+
+// 20 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19);
+}
+
+// 21 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20);
+}
+
+// 22 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21);
+}
+
+// 23 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22);
+}
+
+// 24 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22,
+          typename T23>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22, v23);
+}
+
+// 25 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22,
+          typename T23, typename T24>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                const T24 &v24)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22, v23, v24);
+}
+
+// 26 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22,
+          typename T23, typename T24, typename T25>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                const T24 &v24, const T25 &v25)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22, v23, v24,
+                     v25);
+}
+
+// 27 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22,
+          typename T23, typename T24, typename T25, typename T26>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                const T24 &v24, const T25 &v25, const T26 &v26)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22, v23, v24,
+                     v25, v26);
+}
+
+// 28 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22,
+          typename T23, typename T24, typename T25, typename T26, typename T27>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22, v23, v24,
+                     v25, v26, v27);
+}
+
+// 29 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22,
+          typename T23, typename T24, typename T25, typename T26, typename T27, typename T28>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27, const T28 &v28)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22, v23, v24,
+                     v25, v26, v27, v28);
+}
+
+// 30 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22,
+          typename T23, typename T24, typename T25, typename T26, typename T27, typename T28, typename T29>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27, const T28 &v28, const T29 &v29)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22, v23, v24,
+                     v25, v26, v27, v28, v29);
+}
+
+// 31 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22,
+          typename T23, typename T24, typename T25, typename T26, typename T27, typename T28, typename T29, typename T30>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27, const T28 &v28, const T29 &v29, const T30 &v30)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22, v23, v24,
+                     v25, v26, v27, v28, v29, v30);
+}
+
+// 32 parameters
+template <typename Fn, typename T, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6,
+          typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+          typename T15, typename T16, typename T17, typename T18, typename T19, typename T20, typename T21, typename T22,
+          typename T23, typename T24, typename T25, typename T26, typename T27, typename T28, typename T29, typename T30,
+          typename T31>
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys,
+                                const T &v, const T1 &v1, const T2 &v2, const T3 &v3, const T4 &v4, const T5 &v5, const T6 &v6, const T7 &v7,
+                                const T8 &v8, const T9 &v9, const T10 &v10, const T11 &v11, const T12 &v12, const T13 &v13, const T14 &v14, const T15 &v15,
+                                const T16 &v16, const T17 &v17, const T18 &v18, const T19 &v19, const T20 &v20, const T21 &v21, const T22 &v22, const T23 &v23,
+                                const T24 &v24, const T25 &v25, const T26 &v26, const T27 &v27, const T28 &v28, const T29 &v29, const T30 &v30, const T31 &v31)
+{
+    if(index == 0)
+        fn(*keys, v);
+    else
+        visit_member(index - 1, fn, keys + 1,
+                     v1, v2, v3, v4, v5, v6, v7, v8,
+                     v9, v10, v11, v12, v13, v14, v15, v16,
+                     v17, v18, v19, v20, v21, v22, v23, v24,
+                     v25, v26, v27, v28, v29, v30, v31);
+}
+
 JSONPACK_API_END_NAMESPACE //jsonpack namespace
 
 
@@ -74,6 +74,73 @@ static inline void make_object(const object_t &json_obj, char* json_ptr, const s
     make_object(json_obj, json_ptr, keys.substr(pos+1, keys.length()-1 ).c_str(), values...);
 }
 
+static inline void make_object(const object_t &UNUSED(json), char* UNUSED(json_ptr), const key_handle* UNUSED(keys) )
+{
+}
+
+template <typename T, typename ...Types >
+static inline void make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, T &val, Types& ...values )
+{
+    type::extract_member(json_obj, json_ptr, *keys, val);
+
+    make_object(json_obj, json_ptr, keys + 1, values...);
+}
+
+////============================== TRY_MAKE_OBJECT ==============================================
+static inline bool try_make_object(const object_t &UNUSED(json), char* UNUSED(json_ptr), const key_handle* UNUSED(keys),
+                                   error &UNUSED(err) )
+{
+    return true;
+}
+
+/**
+ * Non-throwing make_object, stops at the first member that fails
+ */
+template <typename T, typename ...Types >
+static inline bool try_make_object(const object_t &json_obj, char* json_ptr, const key_handle *keys, error &err,
+                                   T &val, Types& ...values )
+{
+    return type::try_extract_member(json_obj, json_ptr, *keys, val, err) &&
+           try_make_object(json_obj, json_ptr, keys + 1, err, values...);
+}
+
+////============================== MARK_RAW ==============================================
+static inline key_filter mark_raw(key_filter filter, const std::size_t &UNUSED(index))
+{
+    return filter;
+}
+
+/**
+ * Flag the raw_json members in the filter built from their names, the
+ * values are only used for their type
+ */
+template <typename T, typename ...Types >
+static inline key_filter mark_raw(key_filter filter, const std::size_t &index, const T &UNUSED(val), const Types& ...values)
+{
+    filter._raw[index] = type::is_raw_json<T>::value;
+
+    return mark_raw(std::move(filter), index + 1, values...);
+}
+
+////============================== VISIT_MEMBER ==============================================
+template <typename Fn>
+static inline void visit_member(const std::size_t &UNUSED(index), Fn &UNUSED(fn), const key_handle* UNUSED(keys))
+{
+}
+
+/**
+ * Call fn(key, value) for the member at index, e.g. to format the members
+ * one at a time
+ */
+template <typename Fn, typename T, typename ...Types >
+static inline void visit_member(const std::size_t &index, Fn &fn, const key_handle *keys, const T &val, const Types& ...values)
+{
+    if(index == 0)
+        fn(*keys, val);
+    else
+        visit_member(index - 1, fn, keys + 1, values...);
+}
+
 JSONPACK_API_END_NAMESPACE //jsonpack namespace
 
 #endif // JSONPACK_SERIALIZER_CPP11_HPP
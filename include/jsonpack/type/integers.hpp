@@ -22,6 +22,7 @@
 
 #include "jsonpack/config.hpp"
 #include "jsonpack/type/json_traits_base.hpp"
+#include "jsonpack/util/numbers.hpp"
 
 
 JSONPACK_API_BEGIN_NAMESPACE
@@ -77,14 +78,14 @@ struct json_extract_traits<bool&, void>
 
     static void extract( const jsonpack::value &v, char* UNUSED(json_ptr), bool &value)
     {
-        position p = v._pos;
+        position p = v.pos();
         value = ( p._type == JTK_TRUE );
     }
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _POS &&
-                (v._pos._type == JTK_TRUE || v._pos._type == JTK_FALSE ) );
+        return (v.field() == _POS &&
+                (v.token() == JTK_TRUE || v.token() == JTK_FALSE ) );
     }
 };
 
@@ -151,13 +152,13 @@ struct json_extract_traits<char&, void>
 
     static void extract(const jsonpack::value &v, char* UNUSED(json_ptr), char &value)
     {
-        value = v._pos._type != JTK_NULL ? *(v._pos._pos) : 0;
+        value = v.token() != JTK_NULL ? *(v.data()) : 0;
     }
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _POS &&
-                (v._pos._type == JTK_STRING_LITERAL || v._pos._type == JTK_NULL ) );
+        return (v.field() == _POS &&
+                (v.token() == JTK_STRING_LITERAL || v.token() == JTK_NULL ) );
     }
 };
 
@@ -167,8 +168,8 @@ struct json_traits_int_common
 {
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _POS &&
-                (v._pos._type == JTK_INTEGER || v._pos._type == JTK_REAL ));
+        return (v.field() == _POS &&
+                (v.token() == JTK_INTEGER || v.token() == JTK_REAL ));
     }
     
     static void extract(const object_t &json, char* json_ptr, const char *key, const std::size_t &len, T &value)
@@ -194,7 +195,15 @@ struct json_traits_int_common
     
     static void extract(const jsonpack::value &v, char* UNUSED(json_ptr), T &value)
     {
-        position p = v._pos;
+        position p = v.pos();
+
+        int_t v_cpy;
+        if( p._type == JTK_INTEGER &&
+            util::number::parse_integer(p._pos, p._count, v_cpy) )   // common case, no copy
+        {
+            value = derived::int_to_value(v_cpy);
+            return;
+        }
         
         if( p._count >= max_digits)
             throw type_error(derived::type_out_of_range());
@@ -206,7 +215,8 @@ struct json_traits_int_common
         memcpy(buffer, str_value, p._count);
         buffer[p._count] = '\0';        //null-terminated
         
-        int_t v_cpy = derived::str_to_int(buffer);
+        errno = 0;
+        v_cpy = derived::str_to_int(buffer);
         if((errno == ERANGE) ||
            v_cpy > std::numeric_limits<int_t>::max() ||
            v_cpy < std::numeric_limits<int_t>::min() )
@@ -19,6 +19,9 @@
 #ifndef JSONPACK_TYPE_TRAITS_BASE_HPP
 #define JSONPACK_TYPE_TRAITS_BASE_HPP
 
+#include <new>
+#include <type_traits>
+
 #include "jsonpack/util/builder.hpp"
 #include "jsonpack/object.hpp"
 
@@ -38,7 +41,11 @@ struct json_traits
     static void append(buffer &json, const char *key, const T &value,
                        const bool &pretty = false, const unsigned &indent = 1, unsigned &level = 0)
     {
-        util::json_builder::append_value(json, key, const_cast<T&>(value).json_pack(pretty, indent, level) );
+        json.append("\"" , 1);
+        json.append( key, strlen(key) ); //"key"
+        json.append("\":", 2);
+
+        append(json, value, pretty, indent, level);
     }
 
     /**
@@ -47,8 +54,7 @@ struct json_traits
     static void append(buffer &json, const T &value,
                        const bool &pretty = false, const unsigned &indent = 1, unsigned &level = 0)
     {
-        char* str = const_cast<T&>(value).json_pack(pretty, indent, level);
-        json.append(str, strlen(str));
+        const_cast<T&>(value).json_pack(json, pretty, indent, level);
         json.append(",", 1);
     }
 };
@@ -61,8 +67,8 @@ struct json_extract_traits
      */
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _OBJ ||
-                ( v._field == _POS && v._pos._type == JTK_NULL ));
+        return (v.field() == _OBJ ||
+                ( v.field() == _POS && v.token() == JTK_NULL ));
     }
 
     /**
@@ -97,13 +103,118 @@ struct json_extract_traits
     static void extract(const jsonpack::value &v, char* json_ptr, T &value)
     {
         //if not null do something
-        if( v._field != _POS )
+        if( v.field() != _POS )
         {
             value.json_unpack( *v._obj , json_ptr ) ;
         }
     }
 };
 
+/**
+ * Searches for a member by precomputed key and extracts it into value.
+ * Type mismatches are reported by the type traits, with their own message.
+ */
+template<typename T>
+inline void extract_member(const object_t &json, char* json_ptr, const key_handle &key, T &value)
+{
+    object_t::const_iterator found = json.find(key);
+    if( found != json.end() )  // exist the current key
+    {
+        if( json_extract_traits<T&, void>::match_token_type(found->second) )
+            json_extract_traits<T&, void>::extract(found->second, json_ptr, value);
+        else
+            json_extract_traits<T&, void>::extract(json, json_ptr, key._ptr, key._bytes, value);
+    }
+}
+
+/**
+ * Types declared with DEFINE_JSON_ATTRIBUTES, which can be unpacked
+ * without throwing
+ */
+template<typename T>
+struct has_try_unpack
+{
+    template<typename U>
+    static auto test(U *u) -> decltype( u->try_json_unpack(std::declval<const object_t&>(), static_cast<char*>(nullptr),
+                                                           std::declval<error&>()), std::true_type() );
+    template<typename U>
+    static std::false_type test(...);
+
+    static const bool value = decltype( test<T>(nullptr) )::value;
+};
+
+inline std::size_t error_offset(const jsonpack::value &v, const char* json_ptr)
+{
+    if( v.field() == _POS && json_ptr != nullptr && v.data() != nullptr )
+        return static_cast<std::size_t>( v.data() - json_ptr );
+    return error::npos;
+}
+
+template<typename T>
+inline bool try_extract_impl(const jsonpack::value &v, char* json_ptr, T &out, error &err, std::true_type) noexcept
+{
+    if( v.field() == _POS ) // null keeps the current value, as extract does
+        return true;
+
+    return out.try_json_unpack(*v._obj, json_ptr, err);
+}
+
+/**
+ * Conversions reporting errors by exception only: range errors, items of
+ * containers. Only caught here, the member itself was already checked.
+ */
+template<typename T>
+inline bool try_extract_impl(const jsonpack::value &v, char* json_ptr, T &out, error &err, std::false_type) noexcept
+{
+    try
+    {
+        json_extract_traits<T&, void>::extract(v, json_ptr, out);
+        return true;
+    }
+    catch(const std::bad_alloc&)
+    {
+        err.set(JERR_ALLOC, error::npos);
+    }
+    catch(const type_error&)
+    {
+        err.set(v.field() == _POS ? JERR_OUT_OF_RANGE : JERR_TYPE_MISMATCH, error_offset(v, json_ptr));
+    }
+    catch(const jsonpack_error&)
+    {
+        err.set(JERR_INVALID_VALUE, error_offset(v, json_ptr));
+    }
+    return false;
+}
+
+/**
+ * Non-throwing extract of a value accepted by match_token_type
+ */
+template<typename T>
+bool try_extract(const jsonpack::value &v, char* json_ptr, T &out, error &err) noexcept
+{
+    return try_extract_impl(v, json_ptr, out, err, std::integral_constant<bool, has_try_unpack<T>::value>());
+}
+
+/**
+ * Non-throwing extract_member: on failure err gets the code, the offset of
+ * the value and the member path.
+ */
+template<typename T>
+inline bool try_extract_member(const object_t &json, char* json_ptr, const key_handle &key, T &value, error &err) noexcept
+{
+    object_t::const_iterator found = json.find(key);
+    if( found == json.end() )
+        return true;
+
+    if( !json_extract_traits<T&, void>::match_token_type(found->second) )
+        err.set(JERR_TYPE_MISMATCH, error_offset(found->second, json_ptr));
+    else if( try_extract(found->second, json_ptr, value, err) )
+        return true;
+
+    err.prepend(key._ptr, key._bytes);
+    return false;
+}
+
 JSONPACK_API_END_NAMESPACE //type
 JSONPACK_API_END_NAMESPACE //jsonpack
 
@@ -19,6 +19,11 @@
 #ifndef JSONPACK_MAPS_HPP
 #define JSONPACK_MAPS_HPP
 
+#include <map>
+#include <unordered_map>
+#include <tuple>
+#include <utility>
+
 #include "jsonpack/type/simple_type.hpp"
 
 JSONPACK_API_BEGIN_NAMESPACE
@@ -81,6 +86,19 @@ struct map_traits
 
 };
 
+/**
+ * Reserve buckets in containers that support it (unordered maps)
+ */
+template<typename Map>
+inline auto map_reserve(Map &map, std::size_t n, int) -> decltype(map.reserve(n), void())
+{
+    map.reserve(n);
+}
+
+template<typename Map>
+inline void map_reserve(Map &, std::size_t, long)
+{}
+
 template<typename Map>
 struct map_traits<Map&>
 {
@@ -110,27 +128,18 @@ struct map_traits<Map&>
 
     static void extract(const jsonpack::value &v, char* json_ptr, Map &value)
     {
-        object_t map = *v._obj;
+        const object_t &map = *v._obj;
         value.clear();
+        map_reserve(value, map.size(), 0);
 
         for(const auto & pair : map)
         {
-#ifndef _MSC_VER
-            // Initialize before use
-            std::string name;
-            name.reserve(pair.first._bytes + 1);
-            name.resize(pair.first._bytes);
-
-            type_t second = {};
-#else
-            std::string name;
-            type_t second;
-#endif
-
-            memcpy(const_cast<char*>(name.data()), pair.first._ptr, pair.first._bytes);
-
-            json_extract_traits<type_t&,void>::extract(pair.second, json_ptr, second);
-            value.insert(value.end(), std::make_pair(name, second));
+            // key and value-initialized mapped value built inside the container
+            typename Map::iterator item = value.emplace_hint(value.end(), std::piecewise_construct,
+                                                             std::forward_as_tuple(pair.first._ptr, pair.first._bytes),
+                                                             std::forward_as_tuple());
+
+            json_extract_traits<type_t&,void>::extract(pair.second, json_ptr, item->second);
         }
     }
 
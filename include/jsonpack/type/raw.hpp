@@ -0,0 +1,154 @@
+/**
+ *  Jsonpack - Raw JSON traits for json operations
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_RAW_HPP
+#define JSONPACK_RAW_HPP
+
+#include "jsonpack/type/json_traits_base.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+/**
+ * Member holding JSON text as is, for subtrees that are only passed along:
+ *
+ *      struct message
+ *      {
+ *          int id;
+ *          jsonpack::raw_json payload;
+ *          DEFINE_JSON_ATTRIBUTES(id, payload)
+ *      };
+ *
+ * As a member of a DEFINE_JSON_ATTRIBUTES type, unpacking validates the
+ * value and copies its bytes from the input without building a DOM, and
+ * packing writes them back verbatim, also in pretty mode. Anywhere else
+ * (nested objects, sequence items, a DOM value) the DOM is built as usual
+ * and serialized back into the text.
+ * An empty raw_json is packed as null.
+ */
+struct raw_json
+{
+    raw_json():
+        _json()
+    {}
+
+    explicit raw_json(std::string json):
+        _json(std::move(json))
+    {}
+
+    bool empty() const
+    { return _json.empty(); }
+
+    std::string _json;
+};
+
+TYPE_BEGIN_NAMESPACE
+
+template<typename T>
+struct is_raw_json : std::false_type
+{};
+
+template<>
+struct is_raw_json<raw_json> : std::true_type
+{};
+
+//-------------------------- RAW_JSON -----------------------------------
+
+template<>
+struct json_traits<raw_json, void>
+{
+    static void append(buffer &json, const char *key, const raw_json &value,
+                       const bool&p, const unsigned&i, unsigned&l)
+    {
+        json.append("\"" , 1);
+        json.append( key, strlen(key) ); //"key"
+        json.append("\":", 2);
+
+        append(json, value, p, i, l);
+    }
+
+    static void append(buffer &json, const raw_json &value,
+                       const bool&, const unsigned&, unsigned&)
+    {
+        if(! value.empty() )
+        {
+            json.append_large( value._json.data(), value._json.length() );
+            json.append(",", 1);
+        }
+        else
+        {
+            json.append( "null,", 5);
+        }
+    }
+};
+
+template<>
+struct json_extract_traits<raw_json&,void>
+{
+    static void extract(const object_t &json, char* json_ptr, const char *key, const std::size_t &len, raw_json &value)
+    {
+        jsonpack::key k;
+        k._bytes = len;
+        k._ptr = key;
+
+        object_t::const_iterator found = json.find(k);
+        if( found != json.end() )    // exist the current key
+            extract(found->second, json_ptr, value);
+    }
+
+    static void extract(const jsonpack::value &v, char* UNUSED(json_ptr), raw_json &value)
+    {
+        if( v.field() == _POS )
+        {
+            if( v.token() == JTK_STRING_LITERAL )   // the slice has no quotes
+            {
+                value._json.reserve(v.length() + 2);
+                value._json.assign("\"", 1);
+                value._json.append(v.data(), v.length());
+                value._json.append("\"", 1);
+            }
+            else
+            {
+                value._json.assign(v.data(), v.length());
+            }
+        }
+        else if( v.field() == _NULL )
+        {
+            value._json.clear();
+        }
+        else
+        {
+            buffer json;
+            v.append(json);
+            json.erase_last_comma();
+            value._json.assign(json.data(), json.size());
+        }
+    }
+
+    /**
+     * Any JSON value
+     */
+    static bool match_token_type(const jsonpack::value &)
+    {
+        return true;
+    }
+};
+
+JSONPACK_API_END_NAMESPACE //type
+JSONPACK_API_END_NAMESPACE //jsonpack
+
+#endif // JSONPACK_RAW_HPP
@@ -20,6 +20,7 @@
 #define JSONPACK_REALS_HPP
 
 #include "jsonpack/type/json_traits_base.hpp"
+#include "jsonpack/util/numbers.hpp"
 
 
 JSONPACK_API_BEGIN_NAMESPACE
@@ -71,7 +72,10 @@ struct json_extract_traits<float&, void>
 
     static void extract(const jsonpack::value &v, char* UNUSED(json_ptr), float &value)
     {
-        position p = v._pos;
+        position p = v.pos();
+
+        if( util::number::parse_float(p._pos, p._count, value) )   // exact without strtof
+            return;
 
 //        char * str_value = json_ptr + p._pos;   //pointing to the start
         char * str_value = p._pos;   //pointing to the start
@@ -81,6 +85,7 @@ struct json_extract_traits<float&, void>
         memcpy(buffer, str_value, len);
         buffer[len] = '\0';    //null-terminated
 
+        errno = 0;
 #ifndef _MSC_VER
         value = std::strtof(buffer, nullptr);
         if(errno == ERANGE) // check range
@@ -97,8 +102,8 @@ struct json_extract_traits<float&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _POS &&
-                (v._pos._type == JTK_INTEGER || v._pos._type == JTK_REAL ) );
+        return (v.field() == _POS &&
+                (v.token() == JTK_INTEGER || v.token() == JTK_REAL ) );
     }
 
 };
@@ -133,7 +138,10 @@ struct json_extract_traits<double&, void>
 
     static void extract(const jsonpack::value &v, char* UNUSED(json_ptr), double &value)
     {
-        position p = v._pos;
+        position p = v.pos();
+
+        if( util::number::parse_double(p._pos, p._count, value) )   // exact without strtod
+            return;
 //        char * str_value = json_ptr + p._pos;   //pointing to the start
         char * str_value = p._pos;   //pointing to the start
 
@@ -142,6 +150,7 @@ struct json_extract_traits<double&, void>
         memcpy(buffer, str_value, len);
         buffer[len] = '\0';     //null-terminated
 
+        errno = 0;
         value = std::strtod(buffer, nullptr);
 
         if(errno == ERANGE) // check range
@@ -150,8 +159,8 @@ struct json_extract_traits<double&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _POS &&
-                (v._pos._type == JTK_INTEGER || v._pos._type == JTK_REAL ) );
+        return (v.field() == _POS &&
+                (v.token() == JTK_INTEGER || v.token() == JTK_REAL ) );
     }
 
 
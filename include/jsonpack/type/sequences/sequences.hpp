@@ -19,13 +19,18 @@
 #ifndef JSONPACK_SEQUENCES_HPP
 #define JSONPACK_SEQUENCES_HPP
 
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <deque>
+#include <exception>
 #include <list>
 #include <forward_list>
 #include <set>
+#include <thread>
 #include <unordered_set>
+#include <type_traits>
+#include <utility>
 
 #include "jsonpack/type/simple_type.hpp"
 
@@ -103,8 +108,149 @@ struct sequence_traits
         json.append("],", 2);
     }
 
+    /**
+     * Fewer items than this per thread are not worth a thread
+     */
+    static const std::size_t parallel_min_items = 1024;
+
+    /**
+     * Same text as append() for random access sequences, the items split
+     * in slices formatted by up to threads threads (the caller's included)
+     * into buffers of their own, then joined in order. Slices of threads
+     * that could not be started are formatted by the caller. Items must not
+     * share state that formatting changes. An exception thrown for any
+     * item is rethrown once all threads finished.
+     */
+    static void append_parallel(buffer &json, const Seq &value, unsigned threads,
+                                const bool&pretty, const unsigned& indent, unsigned& level)
+    {
+        const std::size_t count = value.size();
+        if( threads > count / parallel_min_items )
+            threads = static_cast<unsigned>(count / parallel_min_items);
+
+        if( threads < 2 )
+        {
+            append(json, value, pretty, indent, level);
+            return;
+        }
+
+        const unsigned item_level = pretty ? level + 1 : level;
+        std::vector<buffer> slices(threads);
+        std::vector<std::exception_ptr> errors(threads);
+
+        auto format = [&](unsigned t)
+        {
+            try
+            {
+                auto it = value.begin() + count * t / threads;
+                auto end = value.begin() + count * (t + 1) / threads;
+                for( ; it != end; ++it)
+                {
+                    unsigned l = item_level;
+                    if(pretty)
+                    {
+                        slices[t].append("\n",1);
+                        slices[t].append(' ', indent * l);
+                    }
+                    json_traits<type_t, void>::append(slices[t], *it, pretty, indent, l);
+                }
+            }
+            catch(...)
+            {
+                errors[t] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+
+        unsigned started = 1;
+        try
+        {
+            for( ; started < threads; ++started)
+                workers.push_back( std::thread(format, started) );
+        }
+        catch(...)
+        {
+            // no more threads (std::system_error, or std::bad_alloc for
+            // the thread state): the slices left are formatted here
+        }
+
+        for(unsigned t = started; t < threads; ++t)
+            format(t);
+
+        format(0);
+        for(std::thread &w : workers)
+            w.join();
+
+        for(const std::exception_ptr &e : errors)
+            if(e)
+                std::rethrow_exception(e);
+
+        json.append("[", 1);
+        for(const buffer &slice : slices)
+            json.append(slice.data(), slice.size());
+        json.erase_last_comma();
+
+        if (pretty)
+        {
+            json.append("\n", 1);
+            json.append(' ', indent * level);
+        }
+        json.append("],", 2);
+    }
+
 };
 
+/**
+ * Reserve capacity in containers that support it (vector, unordered sets)
+ */
+template<typename Seq>
+inline auto sequence_reserve(Seq &seq, std::size_t n, int) -> decltype(seq.reserve(n), void())
+{
+    seq.reserve(n);
+}
+
+template<typename Seq>
+inline void sequence_reserve(Seq &, std::size_t, long)
+{}
+
+/**
+ * True for containers where items can be default constructed at the end and
+ * then filled through back() (vector, deque, list; not vector<bool>)
+ */
+template<typename Seq, typename = void>
+struct sequence_in_place : std::false_type
+{};
+
+template<typename Seq>
+struct sequence_in_place<Seq, typename std::enable_if<
+        std::is_same<decltype(std::declval<Seq&>().back()), typename Seq::value_type&>::value>::type>
+        : std::true_type
+{};
+
+/**
+ * True for containers of literals (numbers, booleans, chars, enums, strings)
+ * that grow at the end: sequence_traits::parse fills them straight from the
+ * JSON text. Excludes std::array and forward_list.
+ */
+template<typename Seq, typename = void>
+struct sequence_of_literals : std::false_type
+{};
+
+template<typename T>
+struct literal_item : std::integral_constant<bool,
+                                             std::is_arithmetic<T>::value ||
+                                             std::is_enum<T>::value ||
+                                             std::is_same<T, std::string>::value>
+{};
+
+template<typename Seq>
+struct sequence_of_literals<Seq, decltype(std::declval<Seq&>().insert(std::declval<Seq&>().end(),
+                                                                       std::declval<typename Seq::value_type>()), void())>
+        : literal_item<typename Seq::value_type>
+{};
+
 template<typename Seq>
 struct sequence_traits<Seq&>
 {
@@ -119,7 +265,7 @@ struct sequence_traits<Seq&>
         object_t::const_iterator found = json.find(k);
         if( found != json.end() )    // exist the current key
         {
-            if(found->second._field == _ARR )
+            if(found->second.field() == _ARR )
             {
                 extract(found->second, json_ptr, value);
             }
@@ -132,34 +278,259 @@ struct sequence_traits<Seq&>
         }
     }
 
+    /**
+     * Appends every item to the emptied container
+     */
+    struct append_sink
+    {
+        append_sink(Seq &value, std::size_t n):
+            _value(value)
+        {
+            value.clear();
+            sequence_reserve(value, n, 0);
+        }
+
+        void put(const jsonpack::value &it, char* json_ptr)
+        {
+            add_item(it, json_ptr, _value, sequence_in_place<Seq>());
+        }
+
+        void finish()
+        {}
+
+        Seq &_value;
+    };
+
+    /**
+     * Overwrites the existing items in order, keeping their memory (string
+     * and vector capacities), then appends. finish() erases the items left
+     * from the previous content.
+     */
+    struct reuse_sink
+    {
+        reuse_sink(Seq &value, std::size_t n):
+            _value(value),
+            _next(),
+            _tail(false)
+        {
+            sequence_reserve(value, n, 0);
+            _next = value.begin();
+            _tail = (_next == value.end());
+        }
+
+        void put(const jsonpack::value &it, char* json_ptr)
+        {
+            if(_tail)
+            {
+                add_item(it, json_ptr, _value, std::true_type());
+                return;
+            }
+
+            type_t &item = *_next;
+            if( it.field() == _POS && it.token() == JTK_NULL )  // null leaves the target untouched
+                item = type_t();
+            json_extract_traits<type_t&,void>::extract(it, json_ptr, item);
+
+            _tail = (++_next == _value.end());
+        }
+
+        void finish()
+        {
+            if(!_tail)
+                _value.erase(_next, _value.end());
+        }
+
+        Seq &_value;
+        typename Seq::iterator _next;
+        bool _tail;
+    };
+
+    /**
+     * Items are reused when the result does not depend on the previous
+     * content, i.e. for literals
+     */
+    typedef typename std::conditional<sequence_in_place<Seq>::value && literal_item<type_t>::value,
+                                      reuse_sink, append_sink>::type default_sink;
+
+    typedef typename std::conditional<sequence_in_place<Seq>::value,
+                                      reuse_sink, append_sink>::type merge_sink;
+
     static void extract(const jsonpack::value &v, char* json_ptr, Seq &value)
     {
-        array_t arr = *v._arr;
-        value.clear();
+        fill<default_sink>(v, json_ptr, value);
+    }
+
+    /**
+     * Like extract, but existing items of any type are unpacked over in
+     * place instead of being destroyed: members absent from the JSON keep
+     * their previous value. Only the tail of the container grows or shrinks.
+     */
+    static void merge(const jsonpack::value &v, char* json_ptr, Seq &value)
+    {
+        fill<merge_sink>(v, json_ptr, value);
+    }
+
+    template<typename Sink>
+    static void fill(const jsonpack::value &v, char* json_ptr, Seq &value)
+    {
+        const array_t &arr = *v._arr;
+        Sink sink(value, arr.size());
 
         for(const auto &it : arr)
         {
-#ifndef _MSC_VER
-            // Initialize before use
-            type_t val = {};
-#else
-            type_t val;
-#endif  
             if( json_extract_traits<type_t&,void>::match_token_type(it) )
             {
-                json_extract_traits<type_t&,void>::extract(it, json_ptr, val);
-                value.insert(value.end(), val); //faster way in each container
+                sink.put(it, json_ptr);
             }
             else
             {
                 throw type_error( "Array item type mismatch" );
             }
         }
+
+        sink.finish();
+    }
+
+    /**
+     * Parse a JSON array of literals straight into the container, items are
+     * converted while scanning and no array_t is built. The capacity comes
+     * from a comma count, an upper bound if strings contain commas.
+     */
+    static void parse(const char *json, const std::size_t &len, Seq &value)
+    {
+        error err;
+        if( !try_parse(json, len, value, err) )
+            err.raise();
+    }
+
+    /**
+     * Non-throwing parse. Syntax errors get the code and offset the parser
+     * gives for the same text, except inside a nested container, which is
+     * only skipped: JERR_INVALID_VALUE at the token where it goes wrong.
+     * An item of another type gets JERR_TYPE_MISMATCH and a number that
+     * does not fit JERR_OUT_OF_RANGE, at the item.
+     */
+    static bool try_parse(const char *json, const std::size_t &len, Seq &value, error &err) noexcept
+    {
+        err = error();
+
+        scanner s;
+        s.init(json, len);
+
+        jsonpack_token_type tk = s.next();
+        if( tk != JTK_OPEN_BRACKET )
+            return unexpected(s, JTK_OPEN_BRACKET, tk, err);
+
+        try
+        {
+            default_sink sink(value, std::count(json, json + len, ',') + 1);
+
+            tk = s.next();
+            if( tk != JTK_CLOSE_BRACKET )
+            {
+                if( !is_value_token(tk) )
+                    return s.report(err, JERR_INVALID_VALUE);
+
+                for(;;)
+                {
+                    if( !is_literal_token(tk) )
+                    {
+                        std::size_t at = s._start_token_pos;
+                        if( !s.skip_container(tk) )
+                            return s.report(err, JERR_INVALID_VALUE);
+
+                        err.set(JERR_TYPE_MISMATCH, at);
+                        return false;
+                    }
+
+                    jsonpack::value it( literal_position(s, tk) );
+                    if( !json_extract_traits<type_t&,void>::match_token_type(it) )
+                    {
+                        err.set(JERR_TYPE_MISMATCH, error_offset(it, json));
+                        return false;
+                    }
+
+                    try
+                    {
+                        sink.put(it, const_cast<char*>(json));
+                    }
+                    catch(const type_error&)
+                    {
+                        err.set(JERR_OUT_OF_RANGE, error_offset(it, json));
+                        return false;
+                    }
+                    catch(const jsonpack_error&)
+                    {
+                        err.set(JERR_INVALID_VALUE, error_offset(it, json));
+                        return false;
+                    }
+
+                    tk = s.next();
+                    if( tk == JTK_CLOSE_BRACKET )
+                        break;
+                    if( tk != JTK_COMMA )
+                        return unexpected(s, JTK_CLOSE_BRACKET, tk, err);
+
+                    tk = s.next();
+                    if( !is_value_token(tk) )
+                        return s.report(err, JERR_EXPECT_VALUE);
+                }
+            }
+
+            tk = s.next();
+            if( tk != JTK_EOF )
+                return unexpected(s, JTK_EOF, tk, err);
+
+            sink.finish();
+        }
+        catch(const std::bad_alloc&)
+        {
+            err.set(JERR_ALLOC, error::npos);
+            return false;
+        }
+        return true;
+    }
+
+    static bool is_value_token(const jsonpack_token_type &tk)
+    {
+        return is_literal_token(tk) || tk == JTK_OPEN_KEY || tk == JTK_OPEN_BRACKET;
+    }
+
+    static bool unexpected(const scanner &s, const jsonpack_token_type &expected,
+                           const jsonpack_token_type &found, error &err)
+    {
+        err._expected = expected;
+        err._found = found;
+        return s.report(err, JERR_UNEXPECTED_TOKEN);
+    }
+
+    /**
+     * Construct the item in place at the end of the container
+     */
+    static void add_item(const jsonpack::value &it, char* json_ptr, Seq &value, std::true_type)
+    {
+        value.emplace_back();
+        json_extract_traits<type_t&,void>::extract(it, json_ptr, value.back());
+    }
+
+    /**
+     * Extract into a temporary and move it into the container
+     */
+    static void add_item(const jsonpack::value &it, char* json_ptr, Seq &value, std::false_type)
+    {
+#ifndef _MSC_VER
+        // Initialize before use
+        type_t val = {};
+#else
+        type_t val;
+#endif
+        json_extract_traits<type_t&,void>::extract(it, json_ptr, val);
+        value.insert(value.end(), std::move(val)); //faster way in each container
     }
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -194,7 +565,7 @@ struct json_extract_traits<std::array<T,N>&, void>
         object_t::const_iterator found = json.find(k);
         if( found != json.end() )    // exist the current key
         {
-            if(found->second._field == _ARR )
+            if(found->second.field() == _ARR )
             {
                 extract(found->second, json_ptr, value);
             }
@@ -210,7 +581,10 @@ struct json_extract_traits<std::array<T,N>&, void>
     
     static void extract(const jsonpack::value &v, char* json_ptr, std::array<T,N> &value)
     {
-        array_t arr = *v._arr;
+        const array_t &arr = *v._arr;
+
+        if(arr.size() > N)
+            throw type_error( "Array size mismatch" );
 
         for(std::size_t i = 0 ; i < arr.size(); ++i)
         {
@@ -223,7 +597,7 @@ struct json_extract_traits<std::array<T,N>&, void>
             {
                 json_extract_traits<T&, void>::extract(arr[i], json_ptr, val);
                 // array not support insert operation
-                value[i] = val;
+                value[i] = std::move(val);
             }
             else
             {
@@ -234,7 +608,7 @@ struct json_extract_traits<std::array<T,N>&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -274,7 +648,7 @@ struct json_extract_traits<std::vector<T>&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -298,7 +672,7 @@ struct json_traits< std::deque<T> >
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -317,7 +691,7 @@ struct json_extract_traits<std::deque<T>&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -355,7 +729,7 @@ struct json_extract_traits<std::list<T>&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -391,7 +765,7 @@ struct json_extract_traits<std::forward_list<T>&, void>
         object_t::const_iterator found = json.find(k);
         if( found != json.end() )
         {
-            if(found->second._field == _ARR )
+            if(found->second.field() == _ARR )
             {
                 extract(found->second, json_ptr, value);
             }
@@ -406,23 +780,17 @@ struct json_extract_traits<std::forward_list<T>&, void>
 
     static void extract(const jsonpack::value &v, char* json_ptr, std::forward_list<T> &value)
     {
-        array_t arr = *v._arr;
+        const array_t &arr = *v._arr;
 
         value.clear();
 
         for(const auto &it : arr)
         {
-#ifndef _MSC_VER
-            // Initialize before use
-            T val = {};
-#else
-            T val;
-#endif  
             if( json_extract_traits<T&, void>::match_token_type(it) )
             {
-                json_extract_traits<T&, void>::extract(it, json_ptr, val);
                 // forward_list not support insert operation
-                value.push_front(val);
+                value.emplace_front();
+                json_extract_traits<T&, void>::extract(it, json_ptr, value.front());
             }
             else
             {
@@ -433,7 +801,7 @@ struct json_extract_traits<std::forward_list<T>&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -471,7 +839,7 @@ struct json_extract_traits<std::set<T>&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -509,7 +877,7 @@ struct json_extract_traits<std::multiset<T>&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -547,7 +915,7 @@ struct json_extract_traits<std::unordered_set<T>&, void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
@@ -585,7 +953,7 @@ struct json_traits<std::unordered_multiset<T>& >
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _ARR);
+        return (v.field() == _ARR);
     }
 };
 
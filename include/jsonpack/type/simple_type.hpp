@@ -22,6 +22,7 @@
 #include "jsonpack/type/integers.hpp"
 #include "jsonpack/type/reals.hpp"
 #include "jsonpack/type/strings.hpp"
+#include "jsonpack/type/raw.hpp"
 
 #endif // JSONPACK_TYPE_HPP
 
@@ -87,9 +87,15 @@ struct json_extract_traits<std::string&,void>
 
     static void extract(const jsonpack::value &v, char* UNUSED(json_ptr), std::string &value)
     {
-        position p = v._pos;
+        position p = v.pos();
         if(p._type != JTK_NULL)
         {
+            if( !p._escaped ) // nothing to decode, copy the raw slice
+            {
+                value.assign(p._pos, p._count);
+                return;
+            }
+
             value.clear();
             if (value.capacity() <  p._count + 1)
                 value.reserve(p._count + 1);
@@ -128,13 +134,14 @@ struct json_extract_traits<std::string&,void>
                         uint16_t uc = 0, lc = 0;
                         util::utf8::uchar_t codepoint;
 
-                        util::str::parse_hex(i, uc);
+                        util::str::parse_hex(i, uc);   // i stays on the 'u'
 
                         if (uc >= 0xD800 && uc <= 0xDFFF)
                         {
                             /* Handle UTF-16 surrogate pair. */
-                            if (*i++ != '\\' || *i++ != 'u' || !util::str::parse_hex(i, lc))
+                            if (i[5] != '\\' || i[6] != 'u' || !util::str::parse_hex(i + 6, lc))
                                 throw type_error("Incomplete surrogate pair");
+                            i += 6;
 
                             if (!util::utf8::from_surrogate_pair(uc, lc, codepoint))
                                 throw type_error("Invalid surrogate pair");
@@ -176,8 +183,8 @@ struct json_extract_traits<std::string&,void>
 
     static bool match_token_type(const jsonpack::value &v)
     {
-        return (v._field == _POS &&
-                (v._pos._type == JTK_STRING_LITERAL || v._pos._type == JTK_NULL ) );
+        return (v.field() == _POS &&
+                (v.token() == JTK_STRING_LITERAL || v.token() == JTK_NULL ) );
     }
 
 
@@ -25,7 +25,9 @@
 #include <jsonpack/3rdparty/dtoa.hpp> //fast conversion from reals to string
 
 #include "jsonpack/buffer.hpp"
+#include "jsonpack/util/numbers.hpp"
 #include "jsonpack/util/utf8.hpp"
+#include "jsonpack/util/simd.hpp"
 #include "jsonpack/config.hpp"
 
 /**
@@ -120,97 +122,125 @@ struct json_builder
     {
         if( value != nullptr )
         {
-            json.append("\"", 1);
+            write_string(json, value, len, "\",", 2);
+        }
+        else
+        {
+            json.append( "null,", 5);
+        }
+    }
 
-            unsigned i = 0;
-            const char* str = value;
-            while (/**str != 0*/ i < len)
-            {
-                char c = *str++;
-                i++;
+    /**
+     * Append value escaped and quoted, then the close bytes after the quote
+     */
+    static inline void write_string(buffer &json, const char* value, const std::size_t &len,
+                                    const char* close = "\"", const std::size_t &close_len = 1)
+    {
+        json.append("\"", 1);
 
-                switch (c)
-                {
-                case '"':
-                    json.append("\\\"",2);
-                    break;
-                case '\\':
-                    json.append("\\\\",2);
-                    break;
-                case '\b':
-                    json.append("\\b",2);
-                    break;
-                case '\f':
-                    json.append("\\f",2);
-                    break;
-                case '\n':
-                    json.append("\\n",2);
-                    break;
-                case '\r':
-                    json.append("\\r",2);
-                    break;
-                case '\t':
-                    json.append("\\t",2);
+        // a large string needing no escape is referenced when gathering
+        if( json.gathers(len) && simd::find_escape(value, value + len) == value + len )
+        {
+            json.append_large(value, len);
+            json.append(close, close_len);
+            return;
+        }
 
+        std::size_t i = 0;
+        const char* str = value;
+        while (/**str != 0*/ i < len)
+        {
+            // ASCII characters needing no escape are copied a run at a time
+            const char* run_end = simd::find_escape(str, value + len);
+            if (run_end != str)
+            {
+                json.append(str, run_end - str);
+                i += run_end - str;
+                str = run_end;
+                if (i == len)
                     break;
-                default:
-                    str--;
-                    i--;
+            }
 
-                    size_t count = utf8::validate_char(str);
-                    if (count == 0)
-                    {
-                        throw invalid_json("Invalid utf-8");
-                    }
-                    else if (c < 0x1F)
+            char c = *str++;
+            i++;
+
+            switch (c)
+            {
+            case '"':
+                json.append("\\\"",2);
+                break;
+            case '\\':
+                json.append("\\\\",2);
+                break;
+            case '\b':
+                json.append("\\b",2);
+                break;
+            case '\f':
+                json.append("\\f",2);
+                break;
+            case '\n':
+                json.append("\\n",2);
+                break;
+            case '\r':
+                json.append("\\r",2);
+                break;
+            case '\t':
+                json.append("\\t",2);
+
+                break;
+            default:
+                str--;
+                i--;
+
+                size_t count = utf8::validate_char(str);
+                if (count == 0)
+                {
+                    throw invalid_json("Invalid utf-8");
+                }
+                else if (c < 0x1F)
+                {
+                    /* Encode using \u.... */
+                    uint32_t codepoint;
+                    unsigned s = utf8::read_char(str, codepoint);
+                    str+= s;
+                    i+= s;
+
+                    if (codepoint <= 0xFFFF)
                     {
-                        /* Encode using \u.... */
-                        uint32_t codepoint;
-                        unsigned s = utf8::read_char(str, codepoint);
-                        str+= s;
-                        i+= s;
-
-                        if (codepoint <= 0xFFFF)
-                        {
-                            json.append("\\u", 2);
-                            str::write_hex(json, (uint16_t)codepoint);
-                        }
-                        else
-                        {
-                            /* Produce a surrogate pair. */
-                            uint16_t uc, lc;
-
-                            if(codepoint <= 0x10FFFF)
-                                throw invalid_json("Invalid utf-8");
-
-                            //assert(codepoint <= 0x10FFFF);
-
-                            utf8::to_surrogate_pair(codepoint, uc, lc);
-
-                            json.append("\\u", 2);
-                            str::write_hex(json, uc);
-
-                            json.append("\\u", 2);
-                            str::write_hex(json, lc);
-                        }
+                        json.append("\\u", 2);
+                        str::write_hex(json, (uint16_t)codepoint);
                     }
                     else
                     {
-                        json.append(str, count);
-                        str += count;
-                        i+= count;
-                    }
+                        /* Produce a surrogate pair. */
+                        uint16_t uc, lc;
 
-                    break;
+                        if(codepoint > 0x10FFFF)
+                            throw invalid_json("Invalid utf-8");
+
+                        //assert(codepoint <= 0x10FFFF);
+
+                        utf8::to_surrogate_pair(codepoint, uc, lc);
+
+                        json.append("\\u", 2);
+                        str::write_hex(json, uc);
+
+                        json.append("\\u", 2);
+                        str::write_hex(json, lc);
+                    }
+                }
+                else
+                {
+                    json.append(str, count);
+                    str += count;
+                    i+= count;
                 }
-            }
 
-            json.append("\",", 2);
-        }
-        else
-        {
-            json.append( "null,", 5);
+                break;
+            }
         }
+
+        json.append(close, close_len);
     }
 
 
@@ -224,24 +254,23 @@ struct json_builder
     template<typename Integer>
     static void append_integer(buffer &json, const char *key, const Integer &value)
     {
-        fmt::FormatInt formater(value);
-
         json.append("\"" , 1);
         json.append( key, strlen(key) ); //key
         json.append("\":", 2);
-        json.append( formater.c_str(), formater.size() ); //value
-        json.append(",", 1);
+        append_integer(json, value);
     }
 
     /**
-     * Append integer value to json like (value,)
+     * Append integer value to json like (value,), the digits are written
+     * in place
      */
     template<typename Integer>
     static void append_integer(buffer &json, const Integer &value)
     {
-        fmt::FormatInt formater(value);
-        json.append( formater.c_str(), formater.size() ); //value
-        json.append(",", 1);
+        char* out = json.reserve(number::max_integer_chars + 1);
+        unsigned len = number::write_integer(out, value);
+        out[len] = ',';
+        json.commit(len + 1);
     }
 
 
@@ -251,26 +280,20 @@ struct json_builder
     template<typename Real>
     static void append_real(buffer &json, const char *key, const Real &value)
     {
-        char buf[DOUBLE_MAX_DIGITS] ;
-
-        dtoa_milo(value, buf);
-
         json.append("\"" , 1);
         json.append( key, strlen(key) ); //key
         json.append("\":", 2);
-        json.append( buf, strlen(buf) ); //value
-        json.append(",", 1);
+        append_real(json, value);
     }
 
     template<typename Real>
     static void append_real(buffer &json, const Real &value)
     {
-        char buf[DOUBLE_MAX_DIGITS] ; //signs
-
-        dtoa_milo(value, buf);
+        char* out = json.reserve(DOUBLE_MAX_DIGITS + 1);
 
-        json.append( buf, strlen(buf) ); //value
-        json.append(",", 1);
+        int len = dtoa_milo(value, out);  //writes its terminator too
+        out[len] = ',';
+        json.commit(len + 1);
     }
 
 };
@@ -0,0 +1,338 @@
+/**
+ *  Jsonpack - Fast number conversion
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_NUMBERS_HPP
+#define JSONPACK_NUMBERS_HPP
+
+#include <cfloat>
+#include <cstring>
+#include <limits>
+#include <stdint.h>
+#include <type_traits>
+
+#include "jsonpack/namespace.hpp"
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+    defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64)
+#define JSONPACK_LITTLE_ENDIAN 1
+#endif
+
+JSONPACK_API_BEGIN_NAMESPACE
+UTIL_BEGIN_NAMESPACE
+
+/**
+ * Conversion of JSON number tokens without copying them to a null-terminated
+ * buffer. Each function only handles the common, exactly representable cases
+ * and returns false otherwise, so the caller can fall back to the C library.
+ */
+struct number
+{
+    /**
+     * Maximum count of decimal digits that always fits in uint64_t
+     */
+    static const unsigned max_digits = 19;
+
+#ifdef JSONPACK_LITTLE_ENDIAN
+    /**
+     * True when the 8 bytes at p are all ASCII digits
+     */
+    static inline bool is_eight_digits(const char *p)
+    {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        return ( ( (v & 0xF0F0F0F0F0F0F0F0ULL) |
+                   ( ( (v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL ) >> 4 ) )
+                 == 0x3333333333333333ULL );
+    }
+
+    /**
+     * Value of 8 ASCII digits, combined pairwise inside a 64-bit word (SWAR)
+     */
+    static inline uint32_t parse_eight_digits(const char *p)
+    {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        v = ( (v & 0x0F0F0F0F0F0F0F0FULL) * 2561 ) >> 8;
+        v = ( (v & 0x00FF00FF00FF00FFULL) * 6553601 ) >> 16;
+        return static_cast<uint32_t>( ( (v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL ) >> 32 );
+    }
+#endif
+
+    /**
+     * Accumulate the run of digits starting at p into m. Returns the first
+     * non digit position, count is increased with the digits consumed.
+     * m is only meaningful while count <= max_digits.
+     */
+    static inline const char* parse_digits(const char *p, const char *end, uint64_t &m, unsigned &count)
+    {
+#ifdef JSONPACK_LITTLE_ENDIAN
+        while( end - p >= 8 && is_eight_digits(p) )
+        {
+            m = m * 100000000ULL + parse_eight_digits(p);
+            p += 8;
+            count += 8;
+        }
+#endif
+        while( p < end && static_cast<unsigned>(*p - '0') <= 9 )
+        {
+            m = m * 10 + static_cast<unsigned>(*p - '0');
+            ++p;
+            ++count;
+        }
+        return p;
+    }
+
+    /**
+     * Convert an integer token of len bytes. Returns false for anything
+     * else than an optional minus followed by digits, or if out of Int range.
+     */
+    template<typename Int>
+    static inline bool parse_integer(const char *p, const std::size_t &len, Int &out)
+    {
+        const char *end = p + len;
+        bool negative = ( p < end && *p == '-' );
+        if( negative )
+        {
+            if( !std::is_signed<Int>::value )
+                return false;
+            ++p;
+        }
+
+        uint64_t m = 0;
+        unsigned count = 0;
+        p = parse_digits(p, end, m, count);
+        if( p != end || count == 0 || count > max_digits )
+            return false;
+
+        if( negative )
+        {
+            if( m == 0 )
+            {
+                out = 0;
+                return true;
+            }
+            if( m - 1 > static_cast<uint64_t>(std::numeric_limits<Int>::max()) )
+                return false;
+            out = static_cast<Int>( -static_cast<long long>(m - 1) - 1 );
+            return true;
+        }
+
+        if( m > static_cast<uint64_t>(std::numeric_limits<Int>::max()) )
+            return false;
+        out = static_cast<Int>(m);
+        return true;
+    }
+
+    /**
+     * Convert a real or integer token of len bytes when both mantissa and
+     * power of ten are exact doubles, one rounding gives the correctly
+     * rounded result (Clinger's fast path).
+     */
+    static inline bool parse_double(const char *p, const std::size_t &len, double &out)
+    {
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+        static const double pow10[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        bool negative;
+        uint64_t m;
+        int exp10;
+        if( !decompose(p, len, negative, m, exp10) ||
+            m > (1ULL << 53) || exp10 < -22 || exp10 > 22 )
+            return false;
+
+        double d = static_cast<double>(m);
+        d = exp10 < 0 ? d / pow10[-exp10] : d * pow10[exp10];
+        out = negative ? -d : d;
+        return true;
+#else
+        (void)p; (void)len; (void)out;
+        return false;
+#endif
+    }
+
+    /**
+     * Same as parse_double, rounding directly to float
+     */
+    static inline bool parse_float(const char *p, const std::size_t &len, float &out)
+    {
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+        static const float pow10[] = {
+            1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+        };
+
+        bool negative;
+        uint64_t m;
+        int exp10;
+        if( !decompose(p, len, negative, m, exp10) ||
+            m > (1ULL << 24) || exp10 < -10 || exp10 > 10 )
+            return false;
+
+        float f = static_cast<float>(m);
+        f = exp10 < 0 ? f / pow10[-exp10] : f * pow10[exp10];
+        out = negative ? -f : f;
+        return true;
+#else
+        (void)p; (void)len; (void)out;
+        return false;
+#endif
+    }
+
+    /**
+     * Maximum length written by write_integer(): sign and 19 digits, or
+     * 20 digits
+     */
+    static const unsigned max_integer_chars = 20;
+
+    /**
+     * Count of decimal digits of n: the bit length gives log10 up to one,
+     * a single comparison fixes it (bit twiddling hacks)
+     */
+    static inline unsigned count_digits(uint64_t n)
+    {
+        static const uint64_t pow10[] = {
+            0ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+            100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+            10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+            100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL };
+
+        unsigned t = ( bit_length(n | 1) * 1233 ) >> 12;   // 1233 / 4096 ~ log10(2)
+        return t + 1 - static_cast<unsigned>( n < pow10[t] );
+    }
+
+    /**
+     * Write value at out without terminator, returns the length
+     */
+    template<typename Int>
+    static inline unsigned write_integer(char *out, const Int &value)
+    {
+        uint64_t m = static_cast<uint64_t>(value);
+        unsigned sign = 0;
+        if( is_negative(value, std::is_signed<Int>()) )
+        {
+            *out = '-';
+            m = 0 - m;
+            sign = 1;
+        }
+
+        unsigned digits = count_digits(m);
+        write_digits(out + sign, m, digits);
+        return sign + digits;
+    }
+
+private:
+
+    /**
+     * Split a number token into sign, decimal mantissa and power of ten.
+     * Fails if the mantissa has more than max_digits digits.
+     */
+    static inline bool decompose(const char *p, const std::size_t &len, bool &negative, uint64_t &m, int &exp10)
+    {
+        const char *end = p + len;
+        negative = ( p < end && *p == '-' );
+        if( negative )
+            ++p;
+
+        m = 0;
+        exp10 = 0;
+        unsigned count = 0;
+        p = parse_digits(p, end, m, count);
+
+        if( p < end && *p == '.' )
+        {
+            const char *fraction = ++p;
+            p = parse_digits(p, end, m, count);
+            exp10 = -static_cast<int>(p - fraction);
+        }
+
+        if( p < end && (*p == 'e' || *p == 'E') )
+        {
+            ++p;
+            bool exp_negative = ( p < end && *p == '-' );
+            if( p < end && (*p == '-' || *p == '+') )
+                ++p;
+
+            int e = 0;
+            while( p < end && static_cast<unsigned>(*p - '0') <= 9 )
+            {
+                if( e > 10000 )
+                    return false;
+                e = e * 10 + (*p - '0');
+                ++p;
+            }
+            exp10 += exp_negative ? -e : e;
+        }
+
+        return ( p == end && count != 0 && count <= max_digits );
+    }
+
+    static inline unsigned bit_length(uint64_t n)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 64 - static_cast<unsigned>( __builtin_clzll(n) );
+#else
+        unsigned bits = 0;
+        while(n)
+        {
+            n >>= 1;
+            ++bits;
+        }
+        return bits;
+#endif
+    }
+
+    template<typename Int>
+    static inline bool is_negative(const Int &value, std::true_type)
+    { return value < 0; }
+
+    template<typename Int>
+    static inline bool is_negative(const Int &, std::false_type)
+    { return false; }
+
+    /**
+     * The digits of n end at out + digits, written backwards two at a time
+     */
+    static inline void write_digits(char *out, uint64_t n, const unsigned &digits)
+    {
+        static const char pairs[] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        char *p = out + digits;
+        while( n >= 100 )
+        {
+            unsigned i = static_cast<unsigned>(n % 100) * 2;
+            n /= 100;
+            p -= 2;
+            memcpy(p, pairs + i, 2);
+        }
+
+        if( n >= 10 )
+            memcpy(p - 2, pairs + n * 2, 2);
+        else
+            *(p - 1) = static_cast<char>('0' + n);
+    }
+};
+
+JSONPACK_API_END_NAMESPACE //util
+JSONPACK_API_END_NAMESPACE //jsonpack
+
+#endif // JSONPACK_NUMBERS_HPP
@@ -0,0 +1,90 @@
+/**
+ *  Jsonpack - Runtime dispatch of the byte scanning kernels
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_SIMD_HPP
+#define JSONPACK_SIMD_HPP
+
+#include <atomic>
+
+#include "jsonpack/namespace.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+UTIL_BEGIN_NAMESPACE
+
+enum simd_level : unsigned
+{
+    SIMD_SCALAR = 0,
+    SIMD_SSE42,
+    SIMD_AVX2,
+    SIMD_AVX512,    // AVX-512BW
+
+    SIMD_LEVELS
+};
+
+/**
+ * The library is built for the baseline of the target architecture. The
+ * kernels below are also built for wider instruction sets and the widest
+ * one supported by the running CPU is chosen on first use, unless the build
+ * pinned a level (CMake option JSONPACK_SIMD_LEVEL).
+ * Every kernel returns the first byte of [p, end) in its set, or end.
+ */
+struct simd
+{
+    struct kernels
+    {
+        const char* (*string_special)(const char *p, const char *end);     // '"' '\\' or control char
+        const char* (*escape)(const char *p, const char *end);             // string_special or non-ASCII
+    };
+
+    /**
+     * Widest level supported by both the build and the CPU
+     */
+    static simd_level detected();
+
+    static simd_level active();
+
+    /**
+     * Switch the kernels used by every thread, e.g. to compare levels.
+     * Returns false and keeps the current ones if level is not supported.
+     */
+    static bool select(const simd_level &level);
+
+    static const char* name(const simd_level &level);
+
+    static const char* find_string_special(const char *p, const char *end)
+    { return current()->string_special(p, end); }
+
+    static const char* find_escape(const char *p, const char *end)
+    { return current()->escape(p, end); }
+
+private:
+    static const kernels* current()
+    {
+        const kernels *k = _current.load(std::memory_order_relaxed);
+        return (k != nullptr) ? k : init();
+    }
+
+    static const kernels* init();
+
+    static std::atomic<const kernels*> _current;
+};
+
+JSONPACK_API_END_NAMESPACE //util
+JSONPACK_API_END_NAMESPACE //jsonpack
+
+#endif // JSONPACK_SIMD_HPP
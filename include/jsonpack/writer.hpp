@@ -0,0 +1,274 @@
+/**
+ *  Jsonpack - Streaming writer
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_WRITER_HPP
+#define JSONPACK_WRITER_HPP
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include "jsonpack/buffer.hpp"
+#include "jsonpack/util/builder.hpp"
+#include "jsonpack/type/json_traits_base.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+/**
+ * Member name formatted at compile time as "name": by JSONPACK_KEY, for
+ * writer::key(). The name is written as is, like the member names of
+ * DEFINE_JSON_ATTRIBUTES: it must not need escaping.
+ */
+struct static_key
+{
+    const char* _json;
+    std::size_t _len;
+};
+
+#define JSONPACK_KEY(name) jsonpack::static_key{ "\"" name "\":", sizeof(name) + 2 }
+
+/**
+ * Appends JSON text to a buffer call by call, for documents without a
+ * fixed schema:
+ *
+ *      jsonpack::writer w(json);
+ *      w.begin_object()
+ *          .key(JSONPACK_KEY("id")).value(42)
+ *          .key(name).begin_array().value(3.5).null().end_array()
+ *       .end_object();
+ *
+ * Commas are written before an item when needed, never erased. The calls
+ * must form one valid JSON value, nothing is checked. In pretty mode the
+ * layout is the one of json_pack, except that empty containers stay on
+ * one line.
+ */
+class writer
+{
+public:
+    explicit writer(buffer &json, const bool &pretty = false, const unsigned &indent = 1):
+        _json(json),
+        _pretty(pretty),
+        _indent(indent),
+        _depth(0),
+        _comma(false),
+        _after_key(false)
+    {}
+
+    writer& begin_object()
+    {
+        return open('{');
+    }
+
+    writer& end_object()
+    {
+        return close('}');
+    }
+
+    writer& begin_array()
+    {
+        return open('[');
+    }
+
+    writer& end_array()
+    {
+        return close(']');
+    }
+
+    /**
+     * Member name formatted by JSONPACK_KEY, written with one copy
+     */
+    writer& key(const static_key &name)
+    {
+        separate();
+        _json.append(name._json, name._len);
+        _after_key = true;
+        return *this;
+    }
+
+    /**
+     * Member name known at run time, escaped
+     */
+    writer& key(const char *name, const std::size_t &len)
+    {
+        separate();
+        util::json_builder::write_string(_json, name, len, "\":", 2);
+        _after_key = true;
+        return *this;
+    }
+
+    writer& key(const std::string &name)
+    {
+        return key(name.data(), name.length());
+    }
+
+    writer& value(const bool &v)
+    {
+        separate();
+        if(v)
+            _json.append("true", 4);
+        else
+            _json.append("false", 5);
+        return done();
+    }
+
+    template<typename Integer>
+    typename std::enable_if<std::is_integral<Integer>::value, writer&>::type
+    value(const Integer &v)
+    {
+        separate();
+        char* out = _json.reserve(util::number::max_integer_chars);
+        _json.commit( util::number::write_integer(out, v) );
+        return done();
+    }
+
+    template<typename Real>
+    typename std::enable_if<std::is_floating_point<Real>::value, writer&>::type
+    value(const Real &v)
+    {
+        separate();
+        char* out = _json.reserve(DOUBLE_MAX_DIGITS);
+        _json.commit( dtoa_milo(v, out) );
+        return done();
+    }
+
+    /**
+     * Escaped string, null for a null pointer
+     */
+    writer& value(const char *v, const std::size_t &len)
+    {
+        if(v == nullptr)
+            return null();
+
+        separate();
+        util::json_builder::write_string(_json, v, len);
+        return done();
+    }
+
+    writer& value(const char *v)
+    {
+        return (v != nullptr) ? value(v, strlen(v)) : null();
+    }
+
+    writer& value(const std::string &v)
+    {
+        return value(v.data(), v.length());
+    }
+
+    /**
+     * One character string, as char members are packed
+     */
+    writer& value(const char &c)
+    {
+        return value(&c, 1);
+    }
+
+    /**
+     * Anything json_pack can serialize: structs, sequences, maps
+     */
+    template<typename T>
+    typename std::enable_if<std::is_class<T>::value, writer&>::type
+    value(const T &v)
+    {
+        separate();
+        unsigned level = _depth;
+        type::json_traits<T>::append(_json, v, _pretty, _indent, level);
+        _json.erase_last_comma();
+        return done();
+    }
+
+    writer& null()
+    {
+        separate();
+        _json.append("null", 4);
+        return done();
+    }
+
+    /**
+     * JSON text written as is in place of a value
+     */
+    writer& raw(const char *json, const std::size_t &len)
+    {
+        separate();
+        _json.append_large(json, len);
+        return done();
+    }
+
+    writer(const writer&) = delete;
+    writer& operator=(const writer&) = delete;
+
+private:
+    /**
+     * What goes before a value or a member name: nothing after a name,
+     * else a comma after the previous item and in pretty mode a new line
+     */
+    void separate()
+    {
+        if(_after_key)
+        {
+            _after_key = false;
+            return;
+        }
+
+        if(_comma)
+            _json.append(",", 1);
+
+        if(_pretty && _depth > 0)
+        {
+            _json.append("\n", 1);
+            _json.append(' ', _indent * _depth);
+        }
+    }
+
+    writer& done()
+    {
+        _comma = true;
+        return *this;
+    }
+
+    writer& open(const char bracket)
+    {
+        separate();
+        _json.append(bracket, 1);
+        ++_depth;
+        _comma = false;
+        return *this;
+    }
+
+    writer& close(const char bracket)
+    {
+        --_depth;
+        if(_pretty && _comma)   // not empty
+        {
+            _json.append("\n", 1);
+            _json.append(' ', _indent * _depth);
+        }
+        _json.append(bracket, 1);
+        return done();
+    }
+
+    buffer &_json;
+    bool _pretty;
+    unsigned _indent;
+    unsigned _depth;
+    bool _comma;        // an item was written in the current container
+    bool _after_key;
+};
+
+JSONPACK_API_END_NAMESPACE
+
+#endif // JSONPACK_WRITER_HPP
@@ -0,0 +1,202 @@
+/**
+ *  Jsonpack - Immutable documents shared between threads
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thread>
+
+#include "jsonpack/document.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+/** ****************************************************************************
+ ******************************** DOCUMENT *************************************
+ *******************************************************************************/
+
+document::document(std::string &&json):
+    _text(std::move(json)),
+    _root()
+{
+    // parsed once the text has its final address
+    _root.json_unpack(_text.data(), _text.size());
+}
+
+document_ptr document::parse(const char *json, const std::size_t &len)
+{
+    return parse( std::string(json, len) );
+}
+
+document_ptr document::parse(std::string json)
+{
+    return document_ptr( new document(std::move(json)) );
+}
+
+/** ****************************************************************************
+ ******************************** DRAFT ****************************************
+ *******************************************************************************/
+
+draft::draft(document_ptr base):
+    _base(std::move(base)),
+    _arena(),
+    _root( value::borrow(_base->root()) )
+{}
+
+const std::string& draft::store(std::string &&text)
+{
+    _arena.push_back( std::move(text) );
+    return _arena.back();
+}
+
+/**
+ * Escaped text of str, without the quotes
+ */
+static std::string escape(const std::string &str)
+{
+    buffer json(str.size() + 8);
+    util::json_builder::append_string(json, str.data(), str.size());
+    return std::string(json.data() + 1, json.size() - 3);
+}
+
+key draft::name(const std::string &name)
+{
+    const std::string &text = store( escape(name) );
+
+    key k;
+    k._ptr = text.data();
+    k._bytes = text.size();
+    k._hash = _hash_bytes(text.data(), text.size());
+    return k;
+}
+
+value draft::literal(const jsonpack_token_type &type, const std::string &text)
+{
+    position p;
+    p._type = type;
+    p._escaped = (type == JTK_STRING_LITERAL && text.find('\\') != std::string::npos);
+    p._pos = const_cast<char*>(text.data());
+    p._count = text.size();
+    return value(p);
+}
+
+value draft::string(const std::string &str)
+{
+    return literal( JTK_STRING_LITERAL, store( escape(str) ) );
+}
+
+value draft::integer(const long long &number)
+{
+    char buf[util::number::max_integer_chars];
+    unsigned len = util::number::write_integer(buf, number);
+    return literal( JTK_INTEGER, store( std::string(buf, len) ) );
+}
+
+value draft::real(const double &number)
+{
+    char buf[DOUBLE_MAX_DIGITS];
+    int len = dtoa_milo(number, buf);
+    return literal( JTK_REAL, store( std::string(buf, len) ) );
+}
+
+value draft::boolean(const bool &b)
+{
+    static const std::string true_text("true"), false_text("false");
+    return literal( b ? JTK_TRUE : JTK_FALSE, b ? true_text : false_text );
+}
+
+value draft::parse(const char *json, const std::size_t &len)
+{
+    const std::string &text = store( std::string(json, len) );
+
+    value v;
+    v.json_unpack(text.data(), text.size());
+    return v;
+}
+
+/** ****************************************************************************
+ ******************************** SLOT *****************************************
+ *******************************************************************************/
+
+document_slot::reader::reader(const document_slot &slot):
+    _slot(slot),
+    _parity(0),
+    _node(nullptr)
+{
+    for(;;)
+    {
+        unsigned epoch = slot._epoch.load();
+        _parity = epoch & 1;
+        slot._readers[_parity].fetch_add(1);
+
+        if( slot._epoch.load() == epoch )
+            break;
+
+        // a writer flipped the epoch meanwhile, register again
+        slot._readers[_parity].fetch_sub(1);
+    }
+
+    _node = slot._current.load();
+}
+
+document_slot::reader::~reader()
+{
+    _slot._readers[_parity].fetch_sub(1);
+}
+
+document_slot::document_slot(document_ptr doc):
+    _current( new node(std::move(doc)) ),
+    _epoch(0),
+    _readers(),
+    _writer()
+{
+    _readers[0] = 0;
+    _readers[1] = 0;
+}
+
+document_slot::~document_slot()
+{
+    delete _current.load();
+}
+
+void document_slot::publish(document_ptr doc)
+{
+    node *next = new node(std::move(doc));
+
+    std::lock_guard<std::mutex> lock(_writer);
+
+    node *previous = _current.exchange(next);
+
+    /**
+     * A reader holding previous is registered in either counter: flip away
+     * from each parity in turn and wait for it to drain. New readers join
+     * the other counter, so the wait always ends.
+     */
+    for(int phase = 0; phase < 2; ++phase)
+    {
+        unsigned parity = _epoch.fetch_add(1) & 1;
+        while( _readers[parity].load() != 0 )
+            std::this_thread::yield();
+    }
+
+    delete previous;
+}
+
+document_ptr document_slot::load() const
+{
+    reader current(*this);
+    return current.share();
+}
+
+JSONPACK_API_END_NAMESPACE
@@ -0,0 +1,112 @@
+/**
+ *  Jsonpack - Scatter/gather output
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _WIN32
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <unistd.h>
+#endif
+
+#include "jsonpack/gather.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+std::size_t gather_output::pieces() const
+{
+    std::size_t count = 0;
+    for_each([&count](const char*, std::size_t) { ++count; });
+    return count;
+}
+
+std::size_t gather_output::size() const
+{
+    std::size_t bytes = 0;
+    for_each([&bytes](const char*, std::size_t len) { bytes += len; });
+    return bytes;
+}
+
+std::string gather_output::str() const
+{
+    std::string text;
+    text.reserve( size() );
+    for_each([&text](const char* data, std::size_t len) { text.append(data, len); });
+    return text;
+}
+
+void gather_output::clear()
+{
+    _segments.clear();
+    _json.clear();
+}
+
+#ifndef _WIN32
+
+std::vector<struct iovec> gather_output::iovecs() const
+{
+    std::vector<struct iovec> iov;
+    iov.reserve(_segments.size() + 1);
+    for_each([&iov](const char* data, std::size_t len)
+    {
+        struct iovec v;
+        v.iov_base = const_cast<char*>(data);
+        v.iov_len = len;
+        iov.push_back(v);
+    });
+    return iov;
+}
+
+bool gather_output::write(int fd) const
+{
+#ifdef IOV_MAX
+    const std::size_t max_iov = IOV_MAX;
+#else
+    const std::size_t max_iov = 1024;
+#endif
+
+    std::vector<struct iovec> iov = iovecs();
+    std::size_t first = 0;
+
+    while(first < iov.size())
+    {
+        std::size_t count = std::min(iov.size() - first, max_iov);
+        ssize_t written = ::writev(fd, &iov[first], static_cast<int>(count));
+        if(written < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            return false;
+        }
+
+        // skip the pieces written, cut the one written in part
+        std::size_t left = static_cast<std::size_t>(written);
+        while(first < iov.size() && left >= iov[first].iov_len)
+            left -= iov[first++].iov_len;
+
+        if(left)
+        {
+            iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + left;
+            iov[first].iov_len -= left;
+        }
+    }
+    return true;
+}
+
+#endif
+
+JSONPACK_API_END_NAMESPACE
@@ -18,40 +18,148 @@
  */
 
 #include <string.h>
+#include <new>
 #include <string>
+#include <vector>
 
 #include "jsonpack/parser.hpp"
 #include "jsonpack/object.hpp"
 #include "jsonpack/exceptions.hpp"
+#include "jsonpack/util/simd.hpp"
 
 JSONPACK_API_BEGIN_NAMESPACE
 
+/** ****************************************************************************
+ ******************************** ERRORS ***************************************
+ *******************************************************************************/
+
+static const char* const token_names[] =
+{
+    "Open object",
+    "Close object",
+    "Colon",
+    "Comma",
+    "Open array",
+    "Close array",
+    "String value",
+    "Number value",
+    "Number value",
+    "Boolean value",
+    "Boolean value",
+    "Null value",
+    "Invalid value",
+    "End of input"
+};
+
+static const char* const error_messages[] =
+{
+    "No error",
+    "Empty json string",
+    "JSON must be object or array",
+    "JSON syntax error: Unexpected token",
+    "JSON syntax error: Invalid value",
+    "JSON syntax error: Expect valid string after comma",
+    "JSON syntax error: Expect valid value after comma",
+    "JSON syntax error: Invalid escape",
+    "JSON syntax error: Invalid unicode escape hex value",
+    "JSON syntax error: Control characters are not allowed in string literals",
+    "JSON syntax error: Numbers cannot have leading zeroes",
+    "Types mismatch",
+    "Value out of range",
+    "Out of memory"
+};
+
+std::string error::message() const
+{
+    std::string msg;
+    if(_code == JERR_UNEXPECTED_TOKEN)
+    {
+        msg = "JSON syntax error: Expect '";
+        msg += token_names[_expected];
+        msg += "' but found '";
+        msg += token_names[_found];
+        msg += "'";
+    }
+    else
+    {
+        msg = error_messages[_code];
+    }
+
+    if(_path_len != 0)
+    {
+        msg += " for member ";
+        msg.append(_path, _path_len);
+    }
+
+    if(_offset != npos)
+    {
+        msg += " at position ";
+        msg += std::to_string(_offset);
+    }
+    return msg;
+}
+
+void error::raise() const
+{
+    if(_code == JERR_ALLOC)
+        throw std::bad_alloc();
+
+    if(_code >= JERR_TYPE_MISMATCH)
+        throw type_error( message().c_str() );
+
+    throw invalid_json( message().c_str() );
+}
+
 /** ****************************************************************************
  ******************************** SCANER ***************************************
  *******************************************************************************/
 
-void scanner::init(const char* json, const std::size_t &len)
+bool scanner::init(const char* json, const std::size_t &len)
 {
     _size = len;
+    _i = 0;
+    _error = JERR_NONE;
     if(_size > 0)
     {
-        _source = (_size != 0) ? json : nullptr;
-        _i = 0;
+        _source = json;
         _c = _source[0];
+        return true;
     }
+
+    _source = nullptr;
+    _c = '\0';
+    _error = JERR_EMPTY;
+    return false;
+}
+
+jsonpack_token_type scanner::fail(const error_code &code)
+{
+    _error = code;
+    return JTK_INVALID;
+}
+
+bool scanner::report(error &err, const error_code &code) const
+{
+    if( _error != JERR_NONE )
+        err.set(_error, _i);                    // where the scanner stopped
     else
-    {
-        throw invalid_json("Empty json string");
-    }
+        err.set(code, _start_token_pos);        // at the unexpected token
+    return false;
 }
 
 void scanner::advance()
 {
-    _c = _source[++_i];
+    // the input is not required to be null-terminated: past the end reads as '\0'
+    _c = (++_i < _size) ? _source[_i] : '\0';
 }
 
 jsonpack_token_type scanner::next()
 {
+    _start_token_pos = _i;
+
+    if( _i >= _size )
+        return JTK_EOF;
+
     switch ( _c )
     {
     case '{':
@@ -101,12 +209,25 @@ jsonpack_token_type scanner::next()
 jsonpack_token_type scanner::string_literal()
 {
     _start_token_pos = _i;
+    _escaped = false;
     advance();
 
-    while( _c != '"' && _i < _size )
+    const char *end = _source + _size;
+    while( _i < _size )
     {
+        // plain characters are skipped a block at a time
+        const char *p = util::simd::find_string_special(_source + _i, end);
+        _i = p - _source;
+        if( p == end )
+            break;
+
+        _c = *p;
+        if( _c == '"' )
+            break;
+
         if( _c == '\\') // escape
         {
+            _escaped = true;
             advance();
             switch (_c)
             {
@@ -126,16 +247,16 @@ jsonpack_token_type scanner::string_literal()
                     if (!(_c >= '0' && _c <= '9') &&
                             !(_c >= 'A' && _c <= 'F') &&
                             !(_c >= 'a' && _c <= 'f') )
-                        throw invalid_json("JSON syntax error: Invalid unicode escape hex value");
+                        return fail(JERR_INVALID_UNICODE);
                 }
                 break;
             default:
-                throw invalid_json("JSON syntax error: Invalid escape");
+                return fail(JERR_INVALID_ESCAPE);
             }
         }
-        else if ((unsigned)_c < 0x20)
+        else
         {
-            throw invalid_json("JSON syntax error: Control characters are not allowed in string literals");
+            return fail(JERR_CONTROL_CHARACTER);
         }
 
         advance();
@@ -193,7 +314,7 @@ jsonpack_token_type scanner::number()
         {
         case -1://0
             advance();
-            if( std::isdigit( _c ) ) throw invalid_json("JSON Syntax error: Numbers cannot have leading zeroes");
+            if( std::isdigit( _c ) ) return fail(JERR_LEADING_ZERO);
 
             if(_c == '.') state = 2;
             else if(_c == 'e' || _c == 'E') state = 4;
@@ -276,47 +397,148 @@ key scanner::get_last_key( bool expect_str_literal = false )
 }
 
 
+bool scanner::skip_container(const jsonpack_token_type &open, const bool &after_item)
+{
+    enum expect_t { VALUE_OR_CLOSE, VALUE, KEY_OR_CLOSE, KEY, COLON, COMMA_OR_CLOSE };
+
+    // kind of each open container, set for objects: one bit per level in
+    // a word, the levels past 64 in deeper
+    uint64_t kinds = (open == JTK_OPEN_KEY);
+    std::vector<bool> deeper;
+    unsigned depth = 1;
+    bool object = (open == JTK_OPEN_KEY);
+
+    expect_t expect = after_item ? COMMA_OR_CLOSE :
+                                   object ? KEY_OR_CLOSE : VALUE_OR_CLOSE;
+
+    while(true)
+    {
+        // runs of whitespace (pretty printed input) without a call per byte
+        while( _i < _size && (_c == ' ' || _c == '\n' || _c == '\r' || _c == '\t') )
+            advance();
+
+        jsonpack_token_type tk = next();
+        bool close = false;
+
+        switch (expect)
+        {
+        case KEY_OR_CLOSE:
+        case KEY:
+            if(tk == JTK_STRING_LITERAL)
+                expect = COLON;
+            else if(tk == JTK_CLOSE_KEY && expect == KEY_OR_CLOSE)
+                close = true;
+            else
+                return false;
+            break;
+
+        case COLON:
+            if(tk != JTK_COLON)
+                return false;
+            expect = VALUE;
+            break;
+
+        case VALUE_OR_CLOSE:
+        case VALUE:
+            if( is_literal_token(tk) )
+            {
+                expect = COMMA_OR_CLOSE;
+            }
+            else if(tk == JTK_OPEN_KEY || tk == JTK_OPEN_BRACKET)
+            {
+                object = (tk == JTK_OPEN_KEY);
+                if(depth < 64)
+                    kinds = (kinds & ~(uint64_t(1) << depth)) | (uint64_t(object) << depth);
+                else if(depth - 64 < deeper.size())
+                    deeper[depth - 64] = object;
+                else
+                    deeper.push_back(object);
+
+                ++depth;
+                expect = object ? KEY_OR_CLOSE : VALUE_OR_CLOSE;
+            }
+            else if(tk == JTK_CLOSE_BRACKET && expect == VALUE_OR_CLOSE)
+            {
+                close = true;
+            }
+            else
+            {
+                return false;
+            }
+            break;
+
+        case COMMA_OR_CLOSE:
+            if(tk == JTK_COMMA)
+                expect = object ? KEY : VALUE;
+            else if(tk == (object ? JTK_CLOSE_KEY : JTK_CLOSE_BRACKET))
+                close = true;
+            else
+                return false;
+            break;
+        }
+
+        if(close)
+        {
+            if(--depth == 0)
+                return true;
+
+            object = (depth <= 64) ? ((kinds >> (depth - 1)) & 1) != 0
+                                   : deeper[depth - 65];
+            expect = COMMA_OR_CLOSE;
+        }
+    }
+}
+
+/** ****************************************************************************
+ ******************************** KEY FILTER ***********************************
+ *******************************************************************************/
+
+key_filter::key_filter(const std::string &names):
+    _names(),
+    _raw()
+{
+    std::string::size_type start = 0, pos;
+    while( (pos = names.find(',', start)) != std::string::npos )
+    {
+        _names.push_back( names.substr(start, pos - start) );
+        start = pos + 1;
+    }
+    _names.push_back( names.substr(start) );
+    _raw.assign(_names.size(), false);
+}
+
 /** ****************************************************************************
  ******************************** PARSER ***************************************
  *******************************************************************************/
 
 parser::parser():
     _tk(JTK_INVALID),
-    _s()
+    _s(),
+    _error()
 {}
 
 parser::parser(const parser &p):
     _tk(p._tk),
-    _s(p._s)
+    _s(p._s),
+    _error(p._error)
 {}
 
+//---------------------------------------------------------------------------------------------------
+bool parser::fail(const error_code &code)
+{
+    if( _error.ok() )
+        _s.report(_error, code);
+    return false;
+}
+
 //---------------------------------------------------------------------------------------------------
 bool parser::match(const jsonpack_token_type &token)
 {
     if(_tk != token)
     {
-        std::string token_str[] =
-        {
-            "Open object",
-            "Close object",
-            "Colon",
-            "Comma",
-            "Open array",
-            "Close array",
-            "String value",
-            "Number value",
-            "Number value",
-            "Boolean value",
-            "Boolean value",
-            "Null value",
-            "Ivalid value",
-            "End of input"
-        };
-
-        char msg[256];
-        sprintf(msg, "JSON syntax error: Expect '%s' but found '%s' at %d", token_str[token].c_str(), token_str[_tk].c_str(), _s._i);
-
-        throw invalid_json(msg);
+        _error._expected = token;
+        _error._found = _tk;
+        return fail(JERR_UNEXPECTED_TOKEN);
     }
 
     advance();
@@ -326,12 +548,7 @@ bool parser::match(const jsonpack_token_type &token)
 //---------------------------------------------------------------------------------------------------
 bool parser::is_literal(const jsonpack_token_type &token)
 {
-    return( token == JTK_INTEGER ||
-            token == JTK_REAL ||
-            token == JTK_STRING_LITERAL ||
-            token == JTK_TRUE ||
-            token == JTK_FALSE ||
-            token == JTK_NULL );
+    return is_literal_token(token);
 }
 
 //---------------------------------------------------------------------------------------------------
@@ -341,45 +558,115 @@ void parser::advance()
 }
 
 //---------------------------------------------------------------------------------------------------
-bool parser::json_validate(const char *json,const std::size_t &len, object_t &members )
+bool parser::validate(const char *json, const std::size_t &len, object_t &members, const key_filter *filter)
 {
-    _s.init(json, len);
+    _error = error();
+    if( !_s.init(json, len) )
+        return fail(JERR_EMPTY);
     advance();
 
-    return match(JTK_OPEN_KEY) && item_list(members) && match(JTK_CLOSE_KEY) && match(JTK_EOF);
+    if( match(JTK_OPEN_KEY) && item_list(members, filter) && match(JTK_CLOSE_KEY) && match(JTK_EOF) )
+        return true;
+
+    return fail(JERR_INVALID_VALUE);
 }
 
 //---------------------------------------------------------------------------------------------------
-bool parser::json_validate(const char *json,const std::size_t &len, array_t &elemets )
+bool parser::validate(const char *json, const std::size_t &len, array_t &elemets)
 {
-    _s.init(json, len);
+    _error = error();
+    if( !_s.init(json, len) )
+        return fail(JERR_EMPTY);
     advance();
 
-    return match(JTK_OPEN_BRACKET) && array_list(elemets) && match(JTK_CLOSE_BRACKET) && match(JTK_EOF);
+    if( match(JTK_OPEN_BRACKET) && array_list(elemets) && match(JTK_CLOSE_BRACKET) && match(JTK_EOF) )
+        return true;
+
+    return fail(JERR_INVALID_VALUE);
+}
+
+//---------------------------------------------------------------------------------------------------
+bool parser::json_validate(const char *json,const std::size_t &len, object_t &members )
+{
+    if( !validate(json, len, members, nullptr) )
+        _error.raise();
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------
+bool parser::json_validate(const char *json,const std::size_t &len, object_t &members, const key_filter &filter )
+{
+    if( !validate(json, len, members, &filter) )
+        _error.raise();
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------
+bool parser::json_validate(const char *json,const std::size_t &len, array_t &elemets )
+{
+    if( !validate(json, len, elemets) )
+        _error.raise();
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------
+bool parser::try_validate(const char *json, const std::size_t &len, object_t &members, error &err,
+                          const key_filter *filter) noexcept
+{
+    bool valid = false;
+    try
+    {
+        valid = validate(json, len, members, filter);
+    }
+    catch(const std::bad_alloc&)
+    {
+        _error.set(JERR_ALLOC, error::npos);
+    }
+
+    if( !valid )
+        err = _error;
+    return valid;
+}
+
+//---------------------------------------------------------------------------------------------------
+bool parser::try_validate(const char *json, const std::size_t &len, array_t &elemets, error &err) noexcept
+{
+    bool valid = false;
+    try
+    {
+        valid = validate(json, len, elemets);
+    }
+    catch(const std::bad_alloc&)
+    {
+        _error.set(JERR_ALLOC, error::npos);
+    }
+
+    if( !valid )
+        err = _error;
+    return valid;
 }
 
 //---------------------------------------------------------------------------------------------------
 std::string parser::err_msg()
 {
-    char buff[125];
-    sprintf(buff, "JSON syntax error: near \'%c\' at position %u", _s._c, _s._i);    return std::string(buff);
+    return _error.message();
 }
 
 //---------------------------------------------------------------------------------------------------
-bool parser::item_list(object_t &members)
+bool parser::item_list(object_t &members, const key_filter *filter)
 {
     if(_tk == JTK_CLOSE_KEY)
         return true;
 
-    if( item(members) )
+    if( item(members, filter) )
     {
         if(_tk == JTK_COMMA )
         {
             advance();
             if( _tk != JTK_STRING_LITERAL)
-                throw invalid_json("JSON Syntax error: Expect valid string after comma");
+                return fail(JERR_EXPECT_MEMBER);
 
-            return item_list(members);
+            return item_list(members, filter);
         }
         return true;
     }
@@ -388,7 +675,7 @@ bool parser::item_list(object_t &members)
 }
 
 //---------------------------------------------------------------------------------------------------
-bool parser::item(object_t &members)
+bool parser::item(object_t &members, const key_filter *filter)
 {
     if( _tk == JTK_STRING_LITERAL ) //key
     {
@@ -398,12 +685,69 @@ bool parser::item(object_t &members)
         key k = _s.get_last_key(true);
 
         advance();
+
+        if( filter != nullptr )
+        {
+            std::size_t index = filter->find(k._ptr, k._bytes);
+            if( index == key_filter::npos )
+                return match(JTK_COLON) && skip_value(); // unwanted : value
+
+            if( filter->_raw[index] )
+                return match(JTK_COLON) && raw_value(k, members); // : text of value
+        }
+
         return match(JTK_COLON) && value(k, members); // : value
     }
 
     return false;
 }
 
+//---------------------------------------------------------------------------------------------------
+bool parser::skip_value()
+{
+    if( is_literal(_tk) )
+    {
+        advance();
+        return true;
+    }
+
+    if( _tk == JTK_OPEN_KEY || _tk == JTK_OPEN_BRACKET )
+    {
+        if( !_s.skip_container(_tk) )
+            return false;
+
+        advance();
+        return true;
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------
+bool parser::raw_value(key k, object_t &members)
+{
+    if( _tk != JTK_OPEN_KEY && _tk != JTK_OPEN_BRACKET )
+        return value(k, members); // literals are slices already
+
+    /**
+     * The container is skipped like an unwanted one: its text is validated
+     * but no DOM node is built
+     */
+    position p;
+    p._type = _tk;
+    p._escaped = false;
+    p._pos = const_cast<char*>(_s._source + _s._start_token_pos);
+
+    if( !_s.skip_container(_tk) )
+        return false;
+
+    p._count = _s._source + _s._i - p._pos;
+    members[k] = jsonpack::value(p);
+
+    advance();
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------
 bool parser::value(key k, object_t &members)
 {
@@ -413,14 +757,7 @@ bool parser::value(key k, object_t &members)
         /**
          * Add value into the map with current key
          */
-        bool is_str = (_tk == JTK_STRING_LITERAL);
-        position pos;
-        pos._pos = const_cast<char*>(_s._source +(_s._start_token_pos + is_str));
-        pos._count = _s._i - _s._start_token_pos - 2*is_str;
-        pos._type = _tk;
-
-        jsonpack::value val(pos);
-        members[k] = val;
+        members[k] = jsonpack::value( literal_position(_s, _tk) );
 
         advance();
         return true;
@@ -430,15 +767,12 @@ bool parser::value(key k, object_t &members)
     {
         advance();
 
-        object_t o(16);
-        bool object_ok = item_list(o);
-
-        if(object_ok)
-        {
-            members[k] = new object_t(std::move(o));
+        jsonpack::value &node = members[k];   // references to map items are stable
+        node = new object_t(16);
 
+        if( item_list(*node._obj) )
             return match(JTK_CLOSE_KEY);
-        }
+
         return false;
     }
 
@@ -446,15 +780,12 @@ bool parser::value(key k, object_t &members)
     {
         advance();
 
-        array_t a;
-        bool array_ok = array_list(a);
-
-        if(array_ok)
-        {
-            members[k] = new array_t(std::move(a));
+        jsonpack::value &node = members[k];
+        node = new array_t();
 
+        if( array_list(*node._arr) )
             return match(JTK_CLOSE_BRACKET);
-        }
+
         return false;
     }
 
@@ -473,7 +804,7 @@ bool parser::array_list(array_t &elemets)
         {
             advance();
             if(!is_literal(_tk) && _tk != JTK_OPEN_BRACKET && _tk != JTK_OPEN_KEY)
-                throw invalid_json("JSON Synatax error: Expect valid value after comma");
+                return fail(JERR_EXPECT_VALUE);
 
             return array_list(elemets);
         }
@@ -490,13 +821,7 @@ bool parser::value( array_t &elemets)
         /**
          * Add value into the vector
          */
-        bool is_str = (_tk == JTK_STRING_LITERAL);
-        position pos;
-        pos._pos = const_cast<char*>(_s._source +(_s._start_token_pos + is_str));
-        pos._count = _s._i - _s._start_token_pos - 2*is_str;
-        pos._type = _tk;
-
-        elemets.emplace_back(pos);
+        elemets.emplace_back( literal_position(_s, _tk) );
 
         advance();
         return true;
@@ -506,15 +831,10 @@ bool parser::value( array_t &elemets)
     {
         advance();
 
-        object_t o;
-        bool object_ok = item_list(o);
-
-        if(object_ok)
-        {
-            elemets.emplace_back(new object_t(std::move(o)));
+        elemets.emplace_back(new object_t());   // filled in place, elemets is not touched meanwhile
 
+        if( item_list(*elemets.back()._obj) )
             return match(JTK_CLOSE_KEY);
-        }
 
         return false;
     }
@@ -523,15 +843,11 @@ bool parser::value( array_t &elemets)
     {
         advance();
 
-        array_t a;
-        bool array_ok = array_list(a);
-
-        if(array_ok)
-        {
-            elemets.emplace_back(new array_t(std::move(a)));
+        elemets.emplace_back(new array_t());
 
+        if( array_list(*elemets.back()._arr) )
             return match(JTK_CLOSE_BRACKET);
-        }
+
         return false;
     }
 
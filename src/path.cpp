@@ -0,0 +1,400 @@
+/**
+ *  Jsonpack - Compiled JSON Pointer queries
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <unordered_map>
+
+#include "jsonpack/path.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+/** ****************************************************************************
+ ******************************** COMPILE **************************************
+ *******************************************************************************/
+
+path::path(const std::string &pointer):
+    _segments()
+{
+    if( pointer.empty() )
+        return;
+
+    if( pointer[0] != '/' )
+        throw jsonpack_error("JSON pointer must start with '/'");
+
+    std::string::size_type start = 1;
+    while(true)
+    {
+        std::string::size_type end = pointer.find('/', start);
+        if(end == std::string::npos)
+            end = pointer.length();
+
+        segment seg;
+        seg._name.reserve(end - start);
+        for(std::string::size_type i = start; i < end; ++i)
+        {
+            if(pointer[i] == '~' && i + 1 < end && (pointer[i+1] == '0' || pointer[i+1] == '1'))
+            {
+                seg._name.push_back(pointer[i+1] == '0' ? '~' : '/');
+                ++i;
+            }
+            else
+                seg._name.push_back(pointer[i]);
+        }
+
+        seg._hash = _hash_bytes(seg._name.data(), seg._name.length());
+        seg._wildcard = (seg._name == "*");
+
+        // array index: digits without leading zeroes
+        if( !seg._name.empty() && (seg._name[0] != '0' || seg._name.length() == 1) &&
+                seg._name.find_first_not_of("0123456789") == std::string::npos )
+        {
+            seg._index = std::strtoul(seg._name.c_str(), nullptr, 10);
+        }
+
+        _segments.push_back(std::move(seg));
+
+        if(end == pointer.length())
+            break;
+        start = end + 1;
+    }
+}
+
+/** ****************************************************************************
+ ******************************** NAMES ****************************************
+ *******************************************************************************/
+
+/**
+ * Member name written with escapes, decoded
+ */
+static std::string decoded(const char *name, const std::size_t &bytes)
+{
+    position p;
+    p._type = JTK_STRING_LITERAL;
+    p._escaped = true;
+    p._pos = const_cast<char*>(name);
+    p._count = bytes;
+
+    std::string out;
+    type::json_extract_traits<std::string&, void>::extract(value(p), nullptr, out);
+    return out;
+}
+
+/**
+ * How the member name k, as written in the text, matches name: 2 same
+ * bytes, 1 same once its escapes are decoded, 0 not at all
+ */
+static int match_name(const key &k, const bool &escaped, const std::string &name)
+{
+    if( k._bytes == name.length() && memcmp(k._ptr, name.data(), k._bytes) == 0 )
+        return 2;
+
+    return ( escaped && decoded(k._ptr, k._bytes) == name ) ? 1 : 0;
+}
+
+/** ****************************************************************************
+ ******************************** DOM ******************************************
+ *******************************************************************************/
+
+const value* path::find(const value &root) const
+{
+    return lookup(root, 0);
+}
+
+void path::find_all(const value &root, std::vector<const value*> &out) const
+{
+    collect(root, 0, out);
+}
+
+/**
+ * Member of the object v named by s. Keys keep the text as written, so
+ * when no key has the same bytes the ones with escapes are decoded.
+ */
+const value* path::member(const value &v, const segment &s) const
+{
+    key k;
+    k._ptr = s._name.data();
+    k._bytes = s._name.length();
+    k._hash = s._hash;
+
+    object_t::const_iterator found = v._obj->find(k);
+    if( found != v._obj->end() )
+        return &found->second;
+
+    for(const auto &m : *v._obj)
+    {
+        if( memchr(m.first._ptr, '\\', m.first._bytes) != nullptr && match_name(m.first, true, s._name) != 0 )
+            return &m.second;
+    }
+    return nullptr;
+}
+
+const value* path::lookup(const value &v, std::size_t seg) const
+{
+    if(seg == _segments.size())
+        return &v;
+
+    const segment &s = _segments[seg];
+
+    if( v.is_object() )
+    {
+        if(s._wildcard)
+        {
+            for(const auto &member : *v._obj)
+            {
+                const value *found = lookup(member.second, seg + 1);
+                if(found != nullptr)
+                    return found;
+            }
+            return nullptr;
+        }
+
+        const value *found = member(v, s);
+        return found != nullptr ? lookup(*found, seg + 1) : nullptr;
+    }
+
+    if( v.is_array() )
+    {
+        if(s._wildcard)
+        {
+            for(const auto &item : *v._arr)
+            {
+                const value *found = lookup(item, seg + 1);
+                if(found != nullptr)
+                    return found;
+            }
+            return nullptr;
+        }
+
+        return s._index < v._arr->size() ? lookup((*v._arr)[s._index], seg + 1) : nullptr;
+    }
+
+    return nullptr;
+}
+
+void path::collect(const value &v, std::size_t seg, std::vector<const value*> &out) const
+{
+    if(seg == _segments.size())
+    {
+        out.push_back(&v);
+        return;
+    }
+
+    const segment &s = _segments[seg];
+
+    if( v.is_object() )
+    {
+        if(s._wildcard)
+        {
+            for(const auto &member : *v._obj)
+                collect(member.second, seg + 1, out);
+        }
+        else
+        {
+            const value *found = member(v, s);
+            if( found != nullptr )
+                collect(*found, seg + 1, out);
+        }
+    }
+    else if( v.is_array() )
+    {
+        if(s._wildcard)
+        {
+            for(const auto &item : *v._arr)
+                collect(item, seg + 1, out);
+        }
+        else if(s._index < v._arr->size())
+        {
+            collect((*v._arr)[s._index], seg + 1, out);
+        }
+    }
+}
+
+/** ****************************************************************************
+ ******************************** RAW TEXT *************************************
+ *******************************************************************************/
+
+/**
+ * Consume the value whose first token is tk
+ */
+static inline void skip(scanner &s, const jsonpack_token_type &tk)
+{
+    if( is_literal_token(tk) )
+        return;
+
+    if( (tk != JTK_OPEN_KEY && tk != JTK_OPEN_BRACKET) || !s.skip_container(tk) )
+        throw invalid_json("JSON syntax error: Invalid value");
+}
+
+bool path::find(const char *json, const std::size_t &len, position &out) const
+{
+    std::vector<position> all;
+    find_all(json, len, all);
+    if( all.empty() )
+        return false;
+
+    out = all.front();
+    return true;
+}
+
+void path::find_all(const char *json, const std::size_t &len, std::vector<position> &out) const
+{
+    scanner s;
+    if( !s.init(json, len) )
+        throw invalid_json("Empty json string");
+
+    walk(s, s.next(), 0, out);
+}
+
+/**
+ * Evaluate segment seg on the value starting with the already scanned token
+ * tk, appending the matches to out. The whole value is consumed.
+ */
+void path::walk(scanner &s, jsonpack_token_type tk, std::size_t seg, std::vector<position> &out) const
+{
+    if(seg == _segments.size())
+    {
+        position p;
+        p._type = tk;
+        p._escaped = false;
+
+        if( is_literal_token(tk) )
+        {
+            p = literal_position(s, tk);
+        }
+        else
+        {
+            uint_fast32_t start = s._i - 1; // open token
+            skip(s, tk);
+            p._pos = const_cast<char*>(s._source + start);
+            p._count = s._i - start;
+        }
+
+        out.push_back(p);
+        return;
+    }
+
+    const segment &current = _segments[seg];
+
+    if(tk == JTK_OPEN_KEY)
+    {
+        tk = s.next();
+        if(tk == JTK_CLOSE_KEY)
+            return;
+
+        // as in the DOM a repeated member replaces the earlier one: the
+        // matches found under it are dropped
+        std::size_t mark = out.size();
+        int rank = 0;
+        std::vector< std::pair<std::size_t, bool> > members;     // wildcard: first match of each, replaced
+        std::unordered_map<key, std::size_t, key_hash> seen;    // index in members by name
+        bool replaced = false;
+
+        while(true)
+        {
+            if(tk != JTK_STRING_LITERAL)
+                throw invalid_json("JSON syntax error: Expect member name");
+
+            key k = s.get_last_key(true);
+            bool escaped = s._escaped;
+
+            if(s.next() != JTK_COLON)
+                throw invalid_json("JSON syntax error: Expect ':' after member name");
+
+            tk = s.next();
+
+            if( current._wildcard )
+            {
+                std::pair<std::unordered_map<key, std::size_t, key_hash>::iterator, bool> added =
+                        seen.emplace(k, members.size());
+                if( !added.second )
+                {
+                    members[added.first->second].second = true;
+                    added.first->second = members.size();
+                    replaced = true;
+                }
+                members.push_back( std::make_pair(out.size(), false) );
+                walk(s, tk, seg + 1, out);
+            }
+            else
+            {
+                int r = match_name(k, escaped, current._name);
+                if( r != 0 && r >= rank )  // the same bytes win over an escaped spelling
+                {
+                    out.erase(out.begin() + mark, out.end());
+                    rank = r;
+                    walk(s, tk, seg + 1, out);
+                }
+                else
+                {
+                    skip(s, tk);
+                }
+            }
+
+            tk = s.next();
+            if(tk == JTK_CLOSE_KEY)
+                break;
+            if(tk != JTK_COMMA)
+                throw invalid_json("JSON syntax error: Expect ',' or '}'");
+
+            tk = s.next();
+        }
+
+        if(replaced)
+        {
+            std::size_t to = mark;
+            for(std::size_t i = 0; i < members.size(); ++i)
+            {
+                std::size_t from = members[i].first;
+                std::size_t end = (i + 1 < members.size()) ? members[i + 1].first : out.size();
+                if( !members[i].second )
+                    to = std::copy(out.begin() + from, out.begin() + end, out.begin() + to) - out.begin();
+            }
+            out.erase(out.begin() + to, out.end());
+        }
+        return;
+    }
+
+    if(tk == JTK_OPEN_BRACKET)
+    {
+        tk = s.next();
+        if(tk == JTK_CLOSE_BRACKET)
+            return;
+
+        for(std::size_t index = 0; ; ++index)
+        {
+            if( current._wildcard || index == current._index )
+                walk(s, tk, seg + 1, out);
+            else
+                skip(s, tk);
+
+            tk = s.next();
+            if(tk == JTK_CLOSE_BRACKET)
+                return;
+            if(tk != JTK_COMMA)
+                throw invalid_json("JSON syntax error: Expect ',' or ']'");
+
+            tk = s.next();
+        }
+    }
+
+    // scalar with path segments left: no match
+    skip(s, tk);
+}
+
+JSONPACK_API_END_NAMESPACE
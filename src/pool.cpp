@@ -0,0 +1,109 @@
+/**
+ *  Jsonpack - Per-thread pool of output buffers
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <cstdlib>
+
+#include "jsonpack/pool.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+
+namespace
+{
+
+/**
+ * Blocks of one thread, freed when the thread exits
+ */
+struct free_list
+{
+    struct block
+    {
+        char* _data;
+        std::size_t _alloc;
+    };
+
+    free_list():
+        _blocks(),
+        _count(0)
+    {}
+
+    ~free_list()
+    {
+        clear();
+    }
+
+    void clear() noexcept
+    {
+        while(_count)
+            free( _blocks[--_count]._data );
+    }
+
+    block _blocks[buffer_pool::max_blocks];
+    std::size_t _count;
+};
+
+free_list& local_list()
+{
+    static thread_local free_list list;
+    return list;
+}
+
+}
+
+char* buffer_pool::acquire(std::size_t &alloc)
+{
+    free_list &list = local_list();
+    if(list._count)
+    {
+        free_list::block &b = list._blocks[--list._count];
+        alloc = b._alloc;
+        return b._data;
+    }
+
+    char* data = static_cast<char*>( malloc(8192) );
+    if(!data)
+        throw alloc_error();
+
+    alloc = 8192;
+    return data;
+}
+
+void buffer_pool::recycle(char* data, const std::size_t &alloc) noexcept
+{
+    free_list &list = local_list();
+    if(list._count == max_blocks || alloc > max_block_size)
+    {
+        free(data);
+        return;
+    }
+
+    free_list::block &b = list._blocks[list._count++];
+    b._data = data;
+    b._alloc = alloc;
+}
+
+std::size_t buffer_pool::cached()
+{
+    return local_list()._count;
+}
+
+void buffer_pool::trim() noexcept
+{
+    local_list().clear();
+}
+
+JSONPACK_API_END_NAMESPACE
@@ -0,0 +1,120 @@
+/**
+ *  Jsonpack - Runtime dispatch of the byte scanning kernels
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include "kernels.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+UTIL_BEGIN_NAMESPACE
+
+std::atomic<const simd::kernels*> simd::_current(nullptr);
+
+/**
+ * Kernels built for level, nullptr if this build has none
+ */
+static const simd::kernels* table(const simd_level &level)
+{
+    switch (level)
+    {
+    case SIMD_SCALAR:
+        return &scalar_kernels;
+#if defined(JSONPACK_SIMD_X86)
+    case SIMD_SSE42:
+        return &sse42_kernels;
+    case SIMD_AVX2:
+        return &avx2_kernels;
+    case SIMD_AVX512:
+        return &avx512_kernels;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+/**
+ * cpuid, including the OS support of the wider registers
+ */
+static bool cpu_supports(const simd_level &level)
+{
+#if defined(JSONPACK_SIMD_X86)
+    __builtin_cpu_init();
+    switch (level)
+    {
+    case SIMD_SSE42:
+        return __builtin_cpu_supports("sse4.2");
+    case SIMD_AVX2:
+        return __builtin_cpu_supports("avx2");
+    case SIMD_AVX512:
+        return __builtin_cpu_supports("avx512bw");
+    default:
+        break;
+    }
+#endif
+    return level == SIMD_SCALAR;
+}
+
+simd_level simd::detected()
+{
+#if defined(JSONPACK_SIMD_PINNED)
+    return static_cast<simd_level>(JSONPACK_SIMD_PINNED);
+#else
+    for(unsigned level = SIMD_LEVELS; level-- > SIMD_SCALAR; )
+    {
+        simd_level l = static_cast<simd_level>(level);
+        if( table(l) != nullptr && cpu_supports(l) )
+            return l;
+    }
+    return SIMD_SCALAR;
+#endif
+}
+
+simd_level simd::active()
+{
+    const kernels *k = current();
+    for(unsigned level = SIMD_SCALAR; level < SIMD_LEVELS; ++level)
+    {
+        if( table( static_cast<simd_level>(level) ) == k )
+            return static_cast<simd_level>(level);
+    }
+    return SIMD_SCALAR;
+}
+
+bool simd::select(const simd_level &level)
+{
+    const kernels *k = table(level);
+    if( k == nullptr || !cpu_supports(level) )
+        return false;
+
+    _current.store(k);
+    return true;
+}
+
+const char* simd::name(const simd_level &level)
+{
+    static const char* const names[] = { "scalar", "sse4.2", "avx2", "avx512" };
+    return (level < SIMD_LEVELS) ? names[level] : "unknown";
+}
+
+const simd::kernels* simd::init()
+{
+    const kernels *k = table( detected() );
+    _current.store(k);
+    return k;
+}
+
+JSONPACK_API_END_NAMESPACE //util
+JSONPACK_API_END_NAMESPACE //jsonpack
@@ -0,0 +1,83 @@
+/**
+ *  Jsonpack - Byte scanning kernels, shared by every instruction set
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef JSONPACK_SIMD_KERNELS_HPP
+#define JSONPACK_SIMD_KERNELS_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "jsonpack/util/simd.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+UTIL_BEGIN_NAMESPACE
+
+/**
+ * One table per instruction set, each defined in its own translation unit
+ * built with the matching compiler flags
+ */
+extern const simd::kernels scalar_kernels;
+extern const simd::kernels sse42_kernels;
+extern const simd::kernels avx2_kernels;
+extern const simd::kernels avx512_kernels;
+
+/**
+ * Internal linkage: every translation unit compiles its own copy with its
+ * own flags, so a copy built for AVX2 can never be called from another level
+ */
+namespace {
+
+inline bool is_string_special(unsigned char c)
+{ return c == '"' || c == '\\' || c < 0x20; }
+
+inline bool is_escape(unsigned char c)
+{ return is_string_special(c) || c >= 0x80; }
+
+template<bool (*Pred)(unsigned char)>
+inline const char* scan_bytes(const char *p, const char *end)
+{
+    while( p < end && !Pred( static_cast<unsigned char>(*p) ) )
+        ++p;
+    return p;
+}
+
+#if defined(__GNUC__)
+/**
+ * Block::width bytes per step, Block::mask(p) has bit i set when p[i] is in
+ * the set. The tail shorter than a block is scanned bytewise.
+ */
+template<typename Block, bool (*Pred)(unsigned char)>
+inline const char* scan_blocks(const char *p, const char *end)
+{
+    while( end - p >= Block::width )
+    {
+        uint64_t mask = Block::mask(p);
+        if(mask)
+            return p + __builtin_ctzll(mask);
+        p += Block::width;
+    }
+    return scan_bytes<Pred>(p, end);
+}
+#endif
+
+} // anonymous namespace
+
+JSONPACK_API_END_NAMESPACE //util
+JSONPACK_API_END_NAMESPACE //jsonpack
+
+#endif // JSONPACK_SIMD_KERNELS_HPP
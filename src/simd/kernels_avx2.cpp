@@ -0,0 +1,72 @@
+/**
+ *  Jsonpack - Byte scanning kernels, AVX2 (32 bytes per step)
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <immintrin.h>
+
+#include "kernels.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+UTIL_BEGIN_NAMESPACE
+
+namespace {
+
+inline __m256i load(const char *p)
+{ return _mm256_loadu_si256( reinterpret_cast<const __m256i*>(p) ); }
+
+inline __m256i eq(const __m256i &block, char c)
+{ return _mm256_cmpeq_epi8( block, _mm256_set1_epi8(c) ); }
+
+inline __m256i control(const __m256i &block)
+{ return _mm256_cmpeq_epi8( _mm256_min_epu8(block, _mm256_set1_epi8(0x1F)), block ); }
+
+inline uint64_t bits(const __m256i &hit)
+{ return static_cast<uint32_t>( _mm256_movemask_epi8(hit) ); }
+
+struct string_special_block
+{
+    static const std::ptrdiff_t width = 32;
+
+    static uint64_t mask(const char *p)
+    {
+        __m256i block = load(p);
+        return bits( _mm256_or_si256( _mm256_or_si256(eq(block, '"'), eq(block, '\\')), control(block) ) );
+    }
+};
+
+struct escape_block
+{
+    static const std::ptrdiff_t width = 32;
+
+    static uint64_t mask(const char *p)
+    {
+        __m256i block = load(p);
+        return bits( _mm256_or_si256( _mm256_or_si256(eq(block, '"'), eq(block, '\\')), control(block) ) ) |
+               bits(block);
+    }
+};
+
+} // anonymous namespace
+
+const simd::kernels avx2_kernels =
+{
+    scan_blocks<string_special_block, is_string_special>,
+    scan_blocks<escape_block, is_escape>
+};
+
+JSONPACK_API_END_NAMESPACE //util
+JSONPACK_API_END_NAMESPACE //jsonpack
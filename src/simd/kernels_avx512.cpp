@@ -0,0 +1,68 @@
+/**
+ *  Jsonpack - Byte scanning kernels, AVX-512BW (64 bytes per step)
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <immintrin.h>
+
+#include "kernels.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+UTIL_BEGIN_NAMESPACE
+
+namespace {
+
+inline __m512i load(const char *p)
+{ return _mm512_loadu_si512( reinterpret_cast<const void*>(p) ); }
+
+inline uint64_t eq(const __m512i &block, char c)
+{ return _mm512_cmpeq_epi8_mask( block, _mm512_set1_epi8(c) ); }
+
+inline uint64_t control(const __m512i &block)
+{ return _mm512_cmple_epu8_mask( block, _mm512_set1_epi8(0x1F) ); }
+
+struct string_special_block
+{
+    static const std::ptrdiff_t width = 64;
+
+    static uint64_t mask(const char *p)
+    {
+        __m512i block = load(p);
+        return eq(block, '"') | eq(block, '\\') | control(block);
+    }
+};
+
+struct escape_block
+{
+    static const std::ptrdiff_t width = 64;
+
+    static uint64_t mask(const char *p)
+    {
+        __m512i block = load(p);
+        return eq(block, '"') | eq(block, '\\') | control(block) | _mm512_movepi8_mask(block);
+    }
+};
+
+} // anonymous namespace
+
+const simd::kernels avx512_kernels =
+{
+    scan_blocks<string_special_block, is_string_special>,
+    scan_blocks<escape_block, is_escape>
+};
+
+JSONPACK_API_END_NAMESPACE //util
+JSONPACK_API_END_NAMESPACE //jsonpack
@@ -0,0 +1,75 @@
+/**
+ *  Jsonpack - Byte scanning kernels, SSE4.2 (16 bytes per step)
+ *
+ *  Copyright (c) 2015 Yadiel Martinez Gonzalez <ymglez2015@gmail.com>
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <nmmintrin.h>
+
+#include "kernels.hpp"
+
+JSONPACK_API_BEGIN_NAMESPACE
+UTIL_BEGIN_NAMESPACE
+
+namespace {
+
+inline __m128i load(const char *p)
+{ return _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) ); }
+
+inline __m128i eq(const __m128i &block, char c)
+{ return _mm_cmpeq_epi8( block, _mm_set1_epi8(c) ); }
+
+/**
+ * Bytes 0x00..0x1F: unsigned min leaves them unchanged
+ */
+inline __m128i control(const __m128i &block)
+{ return _mm_cmpeq_epi8( _mm_min_epu8(block, _mm_set1_epi8(0x1F)), block ); }
+
+inline uint64_t bits(const __m128i &hit)
+{ return static_cast<unsigned>( _mm_movemask_epi8(hit) ); }
+
+struct string_special_block
+{
+    static const std::ptrdiff_t width = 16;
+
+    static uint64_t mask(const char *p)
+    {
+        __m128i block = load(p);
+        return bits( _mm_or_si128( _mm_or_si128(eq(block, '"'), eq(block, '\\')), control(block) ) );
+    }
+};
+
+struct escape_block
+{
+    static const std::ptrdiff_t width = 16;
+
+    static uint64_t mask(const char *p)
+    {
+        __m128i block = load(p);
+        return bits( _mm_or_si128( _mm_or_si128(eq(block, '"'), eq(block, '\\')), control(block) ) ) |
+               bits(block);   // high bit: non-ASCII
+    }
+};
+
+} // anonymous namespace
+
+const simd::kernels sse42_kernels =
+{
+    scan_blocks<string_special_block, is_string_special>,
+    scan_blocks<escape_block, is_escape>
+};
+
+JSONPACK_API_END_NAMESPACE //util
+JSONPACK_API_END_NAMESPACE //jsonpack
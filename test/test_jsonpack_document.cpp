@@ -0,0 +1,164 @@
+#define BOOST_TEST_MAIN
+#if !defined( WIN32 )
+    #define BOOST_TEST_DYN_LINK
+#endif
+
+/**
+ * Boost.test causes the following warning under GCC
+ * error: base class 'struct boost::unit_test::ut_detail::nil_t' has
+ * a non-virtual destructor [-Werror=effc++]
+ */
+#if defined __GNUC__
+#pragma GCC diagnostic ignored "-Weffc++"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <jsonpack.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::string version_json(int version)
+{
+    std::string n = std::to_string(version);
+    return "{\"version\":" + n + ",\"routes\":[" + n + "," + n + "," + n + "]}";
+}
+
+BOOST_AUTO_TEST_CASE(document_owns_text_and_dom)
+{
+    std::string json = version_json(7);
+    jsonpack::document_ptr doc = jsonpack::document::parse(json.data(), json.size());
+    json.assign(json.size(), ' ');   // the document keeps its own copy
+
+    BOOST_CHECK_EQUAL(doc->root().at("version").get<int>(), 7);
+    BOOST_CHECK_EQUAL(doc->root().at("routes").at(2).get<int>(), 7);
+    BOOST_CHECK_THROW(doc->root().at("missing"), jsonpack::jsonpack_error);
+    BOOST_CHECK_THROW(doc->root().at("routes").at(3), jsonpack::jsonpack_error);
+
+    int version = 0;
+    BOOST_CHECK(jsonpack::path("/routes/1").get(doc->root(), version));
+    BOOST_CHECK_EQUAL(version, 7);
+
+    BOOST_CHECK_THROW(jsonpack::document::parse("[1,", 3), jsonpack::invalid_json);
+}
+
+BOOST_AUTO_TEST_CASE(readers_see_whole_versions_while_publishing)
+{
+    jsonpack::document_slot slot( jsonpack::document::parse(version_json(0)) );
+
+    const int versions = 50;
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+
+    std::vector<std::thread> readers;
+    for(int t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&]()
+        {
+            int last = 0;
+            while( !done.load() )
+            {
+                jsonpack::document_slot::reader doc(slot);
+
+                int version = doc->root().at("version").get<int>();
+                for(const auto &route : doc->root().at("routes"))
+                    if( route.get<int>() != version )
+                        ++torn;
+
+                if( version < last )
+                    ++torn;
+                last = version;
+            }
+        });
+    }
+
+    jsonpack::document_ptr kept = slot.load();
+    for(int v = 1; v <= versions; ++v)
+        slot.publish( jsonpack::document::parse(version_json(v)) );
+
+    done = true;
+    for(auto &t : readers)
+        t.join();
+
+    BOOST_CHECK_EQUAL(torn.load(), 0);
+    BOOST_CHECK_EQUAL(slot.load()->root().at("version").get<int>(), versions);
+    BOOST_CHECK_EQUAL(kept->root().at("version").get<int>(), 0);   // still alive
+}
+
+BOOST_AUTO_TEST_CASE(cache_extracts_each_literal_once)
+{
+    jsonpack::document_ptr doc = jsonpack::document::parse(
+                std::string("{\"price\":12.5,\"name\":\"tab\\there\",\"qty\":3,\"ok\":true}") );
+    const jsonpack::value &root = doc->root();
+
+    jsonpack::value_cache cache;
+    const std::string &name = cache.get<std::string>( root.at("name") );
+    BOOST_CHECK_EQUAL(name, "tab\there");
+    BOOST_CHECK(&cache.get<std::string>( root.at("name") ) == &name);
+
+    BOOST_CHECK_EQUAL(cache.get<double>( root.at("price") ), 12.5);
+    BOOST_CHECK_EQUAL(cache.get<int>( root.at("qty") ), 3);
+    BOOST_CHECK_EQUAL(cache.get<double>( root.at("qty") ), 3.0);   // one entry per type
+    BOOST_CHECK(cache.get<bool>( root.at("ok") ));
+    BOOST_CHECK_EQUAL(cache.size(), 5u);
+
+    BOOST_CHECK_THROW(cache.get<int>( root.at("name") ), jsonpack::type_error);
+    BOOST_CHECK_EQUAL(cache.size(), 5u);
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+
+    // a literal replaced in place is extracted again
+    jsonpack::draft edit(doc);
+    jsonpack::value &qty = edit.root().edit("qty");
+    BOOST_CHECK_EQUAL(cache.get<int>(qty), 3);
+    qty = edit.integer(4);
+    BOOST_CHECK_EQUAL(cache.get<int>(qty), 4);
+    qty = edit.string("five");
+    BOOST_CHECK_EQUAL(cache.get<std::string>(qty), "five");
+    BOOST_CHECK_THROW(cache.get<int>(qty), jsonpack::type_error);
+}
+
+BOOST_AUTO_TEST_CASE(draft_copies_only_the_edited_path)
+{
+    jsonpack::document_ptr doc = jsonpack::document::parse(
+                std::string("{\"id\":1,\"meta\":{\"tags\":[\"a\"],\"src\":\"x\"},\"body\":[1,2,3]}") );
+
+    jsonpack::draft edit(doc);
+    edit.root().set( edit.name("region"), edit.string("eu \"west\"") );
+    edit.root().set( edit.name("id"), edit.integer(2) );
+    edit.root().edit("meta").edit("tags").push_back( edit.boolean(true) );
+    edit.root().edit("meta").erase("src");
+    edit.root().set( edit.name("extra"), edit.parse("{\"r\":0.5}", 9) );
+
+    // the base is untouched
+    const jsonpack::value &base = doc->root();
+    BOOST_CHECK_EQUAL(base.size(), 3u);
+    BOOST_CHECK_EQUAL(base.at("id").get<int>(), 1);
+    BOOST_CHECK_EQUAL(base.at("meta").at("tags").size(), 1u);
+    BOOST_CHECK(base.at("meta").find("src") != nullptr);
+
+    // the edited path is copied, the rest is shared
+    const jsonpack::value &root = edit.root();
+    BOOST_CHECK(root.at("meta").at("tags")._arr != base.at("meta").at("tags")._arr);
+    BOOST_CHECK(root.at("body")._arr == base.at("body")._arr);
+    BOOST_CHECK(root.at("body").borrowed());
+
+    BOOST_CHECK_EQUAL(root.at("id").get<int>(), 2);
+    BOOST_CHECK_EQUAL(root.at("region").get<std::string>(), "eu \"west\"");
+    BOOST_CHECK(root.at("meta").at("tags").at(1).get<bool>());
+    BOOST_CHECK(root.at("meta").find("src") == nullptr);
+    BOOST_CHECK_EQUAL(root.at("extra").at("r").get<double>(), 0.5);
+
+    char *json = edit.json_pack();
+    jsonpack::document_ptr packed = jsonpack::document::parse(json, strlen(json));
+    free(json);
+    BOOST_CHECK_EQUAL(packed->root().size(), 5u);
+    BOOST_CHECK_EQUAL(packed->root().at("region").get<std::string>(), "eu \"west\"");
+    BOOST_CHECK_EQUAL(packed->root().at("body").at(2).get<int>(), 3);
+
+    BOOST_CHECK_THROW(edit.root().edit("missing"), jsonpack::jsonpack_error);
+    BOOST_CHECK_THROW(edit.root().edit("body").insert(4, jsonpack::value()), jsonpack::jsonpack_error);
+}
@@ -18,6 +18,7 @@
 #include <limits>
 #include <cstring>
 #include <cstdio>
+#include <vector>
 
 struct  TestInt
 {
@@ -112,3 +113,35 @@ BOOST_AUTO_TEST_CASE(unpack_integers_min_finite_value)
 	BOOST_CHECK_EQUAL(jsonpack_int.test_long, std::numeric_limits<long>::min());
 	BOOST_CHECK_EQUAL(jsonpack_int.test_llong, std::numeric_limits<long long>::min());
 }
+
+BOOST_AUTO_TEST_CASE(write_integers_at_every_digit_count)
+{
+    char out[32];
+    char expect[32];
+
+    unsigned long long n = 1;
+    for(int digits = 1; digits <= 20; ++digits, n *= 10)
+    {
+        const unsigned long long values[] = { n - 1, n, n + 1, n * 9 + (n - 1) };
+        for(unsigned long long v : values)
+        {
+            unsigned len = jsonpack::util::number::write_integer(out, v);
+            sprintf(expect, "%llu", v);
+            BOOST_CHECK_EQUAL(std::string(out, len), expect);
+        }
+    }
+
+    unsigned len = jsonpack::util::number::write_integer(out, std::numeric_limits<unsigned long long>::max());
+    BOOST_CHECK_EQUAL(std::string(out, len), "18446744073709551615");
+    len = jsonpack::util::number::write_integer(out, std::numeric_limits<long long>::min());
+    BOOST_CHECK_EQUAL(std::string(out, len), "-9223372036854775808");
+    len = jsonpack::util::number::write_integer(out, (short)-7);
+    BOOST_CHECK_EQUAL(std::string(out, len), "-7");
+
+    // digits reserved past the end of a fixed buffer still land when they fit
+    std::vector<int> seq = {12345, 6};
+    char fixed[11];
+    BOOST_CHECK_EQUAL(jsonpack::json_pack_sequence(seq, fixed, sizeof(fixed)), 9u);
+    BOOST_CHECK_EQUAL(std::string(fixed), "[12345,6]");
+    BOOST_CHECK_EQUAL(jsonpack::json_pack_sequence(seq, fixed, 5), 9u);
+}
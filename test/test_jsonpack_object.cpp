@@ -0,0 +1,622 @@
+#define BOOST_TEST_MAIN
+#if !defined( WIN32 )
+    #define BOOST_TEST_DYN_LINK
+#endif
+
+/**
+ * Boost.test causes the following warning under GCC
+ * error: base class 'struct boost::unit_test::ut_detail::nil_t' has
+ * a non-virtual destructor [-Werror=effc++]
+ */
+#if defined __GNUC__
+#pragma GCC diagnostic ignored "-Weffc++"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <jsonpack.hpp>
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+struct  TestSlice
+{
+    TestSlice():
+        id(0),
+        name()
+    {}
+
+    int id;
+    std::string name;
+    DEFINE_JSON_ATTRIBUTES(id, name)
+};
+
+BOOST_AUTO_TEST_CASE(unpack_skips_undeclared_members)
+{
+    const char json[] =
+            "{\"big\":[[1,2,{\"x\":\"]}\"}],[3.5e2,null,true]],"
+            "\"id\":42,"
+            "\"text\":\"a \\\"quoted\\\" [brace] {\\\\}\","
+            "\"nested\":{\"a\":{\"b\":[{}]},\"c\":\"}\"},"
+            "\"name\":\"slice\"}";
+
+    TestSlice out;
+    out.json_unpack(json, strlen(json));
+
+    BOOST_CHECK_EQUAL(out.id, 42);
+    BOOST_CHECK_EQUAL(out.name, "slice");
+}
+
+BOOST_AUTO_TEST_CASE(unpack_rejects_unbalanced_skipped_member)
+{
+    const char unclosed_array[] = "{\"id\":1,\"big\":[1,[2,3]}";
+    const char unclosed_string[] = "{\"id\":1,\"big\":{\"a\":\"b}}";
+
+    TestSlice out;
+    BOOST_CHECK_THROW(out.json_unpack(unclosed_array, strlen(unclosed_array)), jsonpack::invalid_json);
+    BOOST_CHECK_THROW(out.json_unpack(unclosed_string, strlen(unclosed_string)), jsonpack::invalid_json);
+}
+
+BOOST_AUTO_TEST_CASE(unpack_rejects_invalid_skipped_member)
+{
+    const char* const invalid[] =
+    {
+        "{\"id\":1,\"big\":[1,2}}",                    // mismatched brackets
+        "{\"id\":1,\"big\":{\"a\":1]}",
+        "{\"id\":1,\"big\":[garbage!!],\"name\":\"x\"}", // not a JSON value
+        "{\"id\":1,\"big\":{\"a\" 1},\"name\":\"x\"}",   // missing colon
+        "{\"id\":1,\"big\":[1 2],\"name\":\"x\"}"         // missing comma
+    };
+
+    for(const char* json : invalid)
+    {
+        TestSlice out;
+        BOOST_CHECK_THROW(out.json_unpack(json, strlen(json)), jsonpack::invalid_json);
+
+        jsonpack::value v;
+        BOOST_CHECK_THROW(v.json_unpack(json, strlen(json)), jsonpack::invalid_json);
+    }
+
+    // bracket kinds are tracked past 64 levels too
+    std::string deep = "{\"id\":1,\"big\":" + std::string(100, '[') + "{}";
+    for(int i = 0; i < 100; ++i)
+        deep += (i == 20) ? '}' : ']';
+    deep += "}";
+
+    TestSlice out;
+    BOOST_CHECK_THROW(out.json_unpack(deep.data(), deep.size()), jsonpack::invalid_json);
+
+    deep[deep.size() - 81] = ']';
+    out.json_unpack(deep.data(), deep.size());
+    BOOST_CHECK_EQUAL(out.id, 1);
+}
+
+static const char path_doc[] =
+        "{\"store\":{\"book\":[{\"title\":\"Sayings\",\"price\":8.95},"
+        "{\"title\":\"Sword\",\"price\":12.99,\"tags\":[\"a\",\"b\"]}],"
+        "\"a/b\":1,\"m~n\":2},\"count\":2}";
+
+BOOST_AUTO_TEST_CASE(path_find_on_dom)
+{
+    jsonpack::value doc;
+    doc.json_unpack(path_doc, strlen(path_doc));
+
+    jsonpack::path title("/store/book/1/title");
+    std::string out;
+    BOOST_CHECK(title.get(doc, out));
+    BOOST_CHECK_EQUAL(out, "Sword");
+
+    int n = 0;
+    BOOST_CHECK(jsonpack::path("/store/a~1b").get(doc, n));
+    BOOST_CHECK_EQUAL(n, 1);
+    BOOST_CHECK(jsonpack::path("/store/m~0n").get(doc, n));
+    BOOST_CHECK_EQUAL(n, 2);
+
+    BOOST_CHECK(jsonpack::path("/store/book/2/title").find(doc) == nullptr);
+    BOOST_CHECK(jsonpack::path("/count/x").find(doc) == nullptr);
+
+    std::vector<const jsonpack::value*> prices;
+    jsonpack::path("/store/book/*/price").find_all(doc, prices);
+    BOOST_CHECK_EQUAL(prices.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(path_find_on_raw_text)
+{
+    const std::size_t len = strlen(path_doc);
+
+    jsonpack::position p;
+    BOOST_CHECK(jsonpack::path("/store/book/1/title").find(path_doc, len, p));
+    BOOST_CHECK_EQUAL(std::string(p._pos, p._count), "Sword");
+
+    BOOST_CHECK(jsonpack::path("/store/book/1/tags").find(path_doc, len, p));
+    BOOST_CHECK_EQUAL(p._type, jsonpack::JTK_OPEN_BRACKET);
+    BOOST_CHECK_EQUAL(std::string(p._pos, p._count), "[\"a\",\"b\"]");
+
+    std::vector<std::string> tags;
+    BOOST_CHECK(jsonpack::path("/store/book/1/tags").get(path_doc, len, tags));
+    BOOST_CHECK_EQUAL(tags.size(), 2u);
+
+    std::vector<jsonpack::position> titles;
+    jsonpack::path("/store/book/*/title").find_all(path_doc, len, titles);
+    BOOST_REQUIRE_EQUAL(titles.size(), 2u);
+    BOOST_CHECK_EQUAL(std::string(titles[0]._pos, titles[0]._count), "Sayings");
+    BOOST_CHECK_EQUAL(std::string(titles[1]._pos, titles[1]._count), "Sword");
+
+    int count = 0;
+    BOOST_CHECK(jsonpack::path("/count").get(path_doc, len, count));
+    BOOST_CHECK_EQUAL(count, 2);
+
+    BOOST_CHECK(!jsonpack::path("/missing").find(path_doc, len, p));
+}
+
+BOOST_AUTO_TEST_CASE(path_raw_text_agrees_with_dom)
+{
+    const char json[] = "{\"a\\u002fb\":1,\"x\":{\"y\":2},\"k\":[3],\"x\":{\"y\":4,\"z\":5},"
+                        "\"w\":{\"n\":6,\"n\":7,\"m\":8}}";
+
+    // not null-terminated: the scanner must stop at the length
+    std::vector<char> text(json, json + strlen(json));
+    jsonpack::value doc;
+    doc.json_unpack(text.data(), text.size());
+
+    const char* pointers[] = { "/a~1b", "/x/y", "/x/z", "/w/n", "/w/*", "/*/y", "/k/0" };
+    for(const char* pointer : pointers)
+    {
+        jsonpack::path p(pointer);
+
+        std::vector<const jsonpack::value*> nodes;
+        p.find_all(doc, nodes);
+        std::vector<int> from_dom;
+        for(const jsonpack::value* v : nodes)
+            from_dom.push_back( v->get<int>() );
+
+        std::vector<jsonpack::position> slices;
+        p.find_all(text.data(), text.size(), slices);
+        std::vector<int> from_text;
+        for(const jsonpack::position &pos : slices)
+            from_text.push_back( jsonpack::value(pos).get<int>() );
+
+        // DOM members come in hash table order
+        std::sort(from_dom.begin(), from_dom.end());
+        std::sort(from_text.begin(), from_text.end());
+        BOOST_CHECK_MESSAGE(from_dom == from_text, pointer);
+        BOOST_CHECK_MESSAGE(!from_dom.empty(), pointer);
+    }
+
+    int n = 0;
+    BOOST_CHECK(jsonpack::path("/x/y").get(text.data(), text.size(), n));
+    BOOST_CHECK_EQUAL(n, 4);
+    BOOST_CHECK(jsonpack::path("/a~1b").get(doc, n));
+    BOOST_CHECK_EQUAL(n, 1);
+}
+
+BOOST_AUTO_TEST_CASE(key_handle_lookup)
+{
+    constexpr jsonpack::key_handle count("count");
+    static_assert(count._hash == jsonpack::_hash_bytes_ce("count", 5), "compile time hash");
+
+    jsonpack::value doc;
+    doc.json_unpack(path_doc, strlen(path_doc));
+
+    BOOST_CHECK_EQUAL(count._hash, jsonpack::_hash_bytes("count", 5));
+    BOOST_REQUIRE(doc.find(count) != nullptr);
+    BOOST_CHECK_EQUAL(doc.find(count)->get<int>(), 2);
+    BOOST_CHECK(doc.find(jsonpack::key_handle("coun")) == nullptr);
+
+    BOOST_CHECK(doc._obj->find(count) != doc._obj->end());
+    BOOST_CHECK_EQUAL(doc["store"][jsonpack::key_handle("a/b")].get<int>(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(unpack_reports_member_type_mismatch)
+{
+    const char json[] = "{\"id\":\"forty two\",\"name\":\"slice\"}";
+
+    TestSlice out;
+    BOOST_CHECK_THROW(out.json_unpack(json, strlen(json)), jsonpack::type_error);
+}
+
+struct TestOrder
+{
+    TestOrder():
+        item(),
+        qty(0)
+    {}
+
+    TestSlice item;
+    long long qty;
+    DEFINE_JSON_ATTRIBUTES(item, qty)
+};
+
+BOOST_AUTO_TEST_CASE(try_unpack_reports_errors_without_throwing)
+{
+    const char good[] = "{\"item\":{\"id\":7,\"name\":\"pen\"},\"qty\":3}";
+    const char syntax[] = "{\"item\":{\"id\":7,},\"qty\":3}";
+    const char escape[] = "{\"item\":{\"name\":\"a\\qb\"}}";
+    const char mismatch[] = "{\"item\":{\"id\":\"seven\"},\"qty\":3}";
+    const char range[] = "{\"item\":{},\"qty\":99999999999999999999}";
+
+    TestOrder out;
+    jsonpack::error err = out.try_json_unpack(good, strlen(good));
+    BOOST_CHECK(err.ok());
+    BOOST_CHECK_EQUAL(out.item.name, "pen");
+    BOOST_CHECK_EQUAL(out.qty, 3);
+
+    err = out.try_json_unpack(syntax, strlen(syntax));
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_EXPECT_MEMBER);
+    BOOST_CHECK_EQUAL(err._offset, strchr(syntax, '}') - syntax);
+    BOOST_CHECK_THROW(out.json_unpack(syntax, strlen(syntax)), jsonpack::invalid_json);
+
+    err = out.try_json_unpack(escape, strlen(escape));
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_INVALID_ESCAPE);
+
+    err = out.try_json_unpack(mismatch, strlen(mismatch));
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_TYPE_MISMATCH);
+    BOOST_CHECK_EQUAL(err.path(), "/item/id");
+    BOOST_CHECK_EQUAL(err._offset, strstr(mismatch, "seven") - mismatch);
+    BOOST_CHECK_THROW(out.json_unpack(mismatch, strlen(mismatch)), jsonpack::type_error);
+
+    err = out.try_json_unpack(range, strlen(range));
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_OUT_OF_RANGE);
+    BOOST_CHECK_EQUAL(err.path(), "/qty");
+
+    jsonpack::value v;
+    err = v.try_json_unpack("[1,\"a\",01]", 10);
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_LEADING_ZERO);
+    BOOST_CHECK(v.is_null());
+
+    BOOST_REQUIRE(v.try_json_unpack("[1,\"a\"]", 7).ok());
+    int n = 0;
+    BOOST_CHECK(v.at(0).try_get(n).ok());
+    BOOST_CHECK_EQUAL(n, 1);
+    BOOST_CHECK_EQUAL(v.at(1).try_get(n)._code, jsonpack::JERR_TYPE_MISMATCH);
+    BOOST_CHECK_THROW(v.at(1).get<int>(), jsonpack::type_error);
+
+    jsonpack::object_t members;
+    jsonpack::parser p;
+    BOOST_CHECK(!p.try_validate("", 0, members, err));
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_EMPTY);
+    BOOST_CHECK(!p.try_validate("[]", 2, members, err));
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_UNEXPECTED_TOKEN);
+    BOOST_CHECK_EQUAL(err.message(), "JSON syntax error: Expect 'Open object' but found 'Open array' at position 0");
+}
+
+BOOST_AUTO_TEST_CASE(iterate_object_items)
+{
+    const char json[] = "{\"a\":1,\"bb\":2,\"ccc\":3}";
+
+    jsonpack::value doc;
+    doc.json_unpack(json, strlen(json));
+
+    int sum = 0;
+    std::size_t name_bytes = 0;
+    for(const auto &member : doc.items())
+    {
+        name_bytes += member.first._bytes;
+        sum += member.second.get<int>();
+    }
+
+    BOOST_CHECK_EQUAL(doc.items().size(), 3u);
+    BOOST_CHECK_EQUAL(name_bytes, 6u);
+    BOOST_CHECK_EQUAL(sum, 6);
+}
+
+BOOST_AUTO_TEST_CASE(value_layout_and_ownership)
+{
+    const char json[] = "{\"name\":\"a\\\"b\",\"list\":[1,2.5,null]}";
+
+    jsonpack::value doc;
+    doc.json_unpack(json, strlen(json));
+
+    const jsonpack::value &name = doc["name"];
+    BOOST_CHECK(name.is_string());
+    BOOST_CHECK(name.escaped());
+    BOOST_CHECK_EQUAL(name.length(), 4u);
+    BOOST_CHECK(doc["list"][1].is_real());
+    BOOST_CHECK(doc["list"][2].is_null());
+
+    jsonpack::value copy = doc.clone();
+    BOOST_CHECK(copy._obj != doc._obj);
+    BOOST_CHECK_EQUAL(copy["list"].size(), 3u);
+
+    jsonpack::value moved(std::move(copy));
+    BOOST_CHECK(copy.is_null());
+    BOOST_CHECK_EQUAL(moved["list"][0].get<int>(), 1);
+
+    moved = doc["list"].clone();
+    BOOST_CHECK(moved.is_array());
+    doc.cleanup();
+    BOOST_CHECK(doc.is_null());
+    BOOST_CHECK_EQUAL(moved.size(), 3u);
+
+    static_assert(!std::is_copy_constructible<jsonpack::value>::value, "copies must be explicit");
+    static_assert(std::is_nothrow_move_constructible<jsonpack::value>::value, "moves must not throw");
+
+    std::vector<jsonpack::value> stages;
+    stages.push_back(std::move(moved));
+    const jsonpack::array_t *items = stages[0]._arr;
+    stages.emplace_back();
+    stages.emplace_back();
+    BOOST_CHECK(stages[0]._arr == items);   // reallocation moved, not copied
+
+    jsonpack::shared_value shared = jsonpack::share(std::move(stages[0]));
+    jsonpack::shared_value reader = shared;
+    BOOST_CHECK_EQUAL(reader->size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(move_child_into_parent)
+{
+    char json[] = "{\"a\":{\"b\":[1,2,{\"c\":\"x\"}]},\"d\":3}";
+
+    jsonpack::value v;
+    v.json_unpack(json, strlen(json));
+
+    v = std::move(v["a"]);
+    BOOST_REQUIRE(v.is_object());
+    BOOST_CHECK_EQUAL(v["b"].size(), 3u);
+
+    v = std::move(v["b"]);
+    BOOST_REQUIRE(v.is_array());
+
+    v = std::move(v[2]);
+    BOOST_REQUIRE(v.is_object());
+    BOOST_CHECK_EQUAL(v["c"].get<std::string>(), "x");
+}
+
+BOOST_AUTO_TEST_CASE(pack_parsed_value_verbatim)
+{
+    const char json[] = "{\"id\":1.50e+2,\"drop\":[1,2],\"text\":\"a\\u00e9\\n\\\"b\\\"\","
+                        "\"nested\":{\"list\":[true,null,-0.0,{}],\"empty\":[]}}";
+
+    jsonpack::value v;
+    v.json_unpack(json, strlen(json));
+    v._obj->erase( v._obj->find(jsonpack::key_handle("drop")) );
+
+    char *packed = v.json_pack();
+    std::string out(packed);
+    free(packed);
+
+    BOOST_CHECK(out.find("\"drop\"") == std::string::npos);
+    BOOST_CHECK(out.find("\"id\":1.50e+2") != std::string::npos);
+    BOOST_CHECK(out.find("\"text\":\"a\\u00e9\\n\\\"b\\\"\"") != std::string::npos);
+    BOOST_CHECK(out.find("\"list\":[true,null,-0.0,{}]") != std::string::npos);
+    BOOST_CHECK(out.find("\"empty\":[]") != std::string::npos);
+    BOOST_CHECK_EQUAL(out.size(), strlen(json) - strlen("\"drop\":[1,2],"));
+
+    jsonpack::value again;
+    again.json_unpack(out.data(), out.size());
+    BOOST_CHECK_EQUAL(again["text"].get<std::string>(), "a\xc3\xa9\n\"b\"");
+    BOOST_CHECK_EQUAL(again["nested"]["list"].size(), 4u);
+
+    const char array[] = "[1,[\"x\",{}],[]]";
+    jsonpack::value a;
+    a.json_unpack(array, strlen(array));
+    packed = a.json_pack(true, 2);
+    BOOST_CHECK_EQUAL(std::string(packed), "[\n  1,\n  [\n    \"x\",\n    {}\n  ],\n  []\n]");
+    free(packed);
+}
+
+struct TestEnvelope
+{
+    TestEnvelope():
+        id(0),
+        payload(),
+        note()
+    {}
+
+    int id;
+    jsonpack::raw_json payload;
+    jsonpack::raw_json note;
+
+    DEFINE_JSON_ATTRIBUTES(id, payload, note)
+};
+
+BOOST_AUTO_TEST_CASE(raw_json_member_passes_text_through)
+{
+    const char json[] = "{\"note\":\"a\\\"b\",\"payload\": { \"k\" : [1, 2.50, \"}\"] } ,\"id\":7}";
+
+    TestEnvelope e;
+    e.json_unpack(json, strlen(json));
+    BOOST_CHECK_EQUAL(e.id, 7);
+    BOOST_CHECK_EQUAL(e.payload._json, "{ \"k\" : [1, 2.50, \"}\"] }");
+    BOOST_CHECK_EQUAL(e.note._json, "\"a\\\"b\"");
+
+    char *packed = e.json_pack();
+    BOOST_CHECK_EQUAL(std::string(packed), "{\"id\":7,\"payload\":{ \"k\" : [1, 2.50, \"}\"] },\"note\":\"a\\\"b\"}");
+    free(packed);
+
+    // nested in a DOM the subtree is serialized back
+    jsonpack::value v;
+    v.json_unpack(json, strlen(json));
+    BOOST_CHECK_EQUAL(v["payload"].get<jsonpack::raw_json>()._json, "{\"k\":[1,2.50,\"}\"]}");
+
+    TestEnvelope empty;
+    packed = empty.json_pack();
+    BOOST_CHECK_EQUAL(std::string(packed), "{\"id\":0,\"payload\":null,\"note\":null}");
+    free(packed);
+
+    const char unbalanced[] = "{\"payload\":{\"k\":[1}";
+    BOOST_CHECK_THROW(e.json_unpack(unbalanced, strlen(unbalanced)), jsonpack::invalid_json);
+
+    // invalid text is rejected, never kept to be packed back out
+    const char* const invalid[] =
+    {
+        "{\"id\":1,\"payload\":[1,2}}",
+        "{\"id\":1,\"payload\":{\"a\":1]}",
+        "{\"id\":1,\"payload\":[garbage!!],\"note\":null}"
+    };
+
+    for(const char* json : invalid)
+    {
+        TestEnvelope bad;
+        BOOST_CHECK_THROW(bad.json_unpack(json, strlen(json)), jsonpack::invalid_json);
+        BOOST_CHECK(bad.payload.empty());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(pack_into_fixed_buffer_reports_size)
+{
+    TestOrder order;
+    order.item.id = 7;
+    order.item.name = "pen";
+    order.qty = 3;
+
+    char *heap = order.json_pack(true, 2);
+    std::string expected(heap);
+    free(heap);
+
+    char small[16];
+    BOOST_CHECK_EQUAL(order.json_pack(small, sizeof(small), true, 2), expected.size());
+    BOOST_CHECK_EQUAL(order.json_pack(nullptr, 0, true, 2), expected.size());
+
+    char large[256];
+    BOOST_CHECK_EQUAL(order.json_pack(large, sizeof(large), true, 2), expected.size());
+    BOOST_CHECK_EQUAL(std::string(large), expected);
+
+    char *exact = jsonpack::json_pack_exact(order, true, 2);
+    BOOST_CHECK_EQUAL(std::string(exact), expected);
+    free(exact);
+
+    std::vector<int> seq = {1, 22, 333};
+    BOOST_CHECK_EQUAL(jsonpack::json_pack_sequence(seq, small, 4), 10u);
+    BOOST_CHECK_EQUAL(jsonpack::json_pack_sequence(seq, large, sizeof(large)), 10u);
+    BOOST_CHECK_EQUAL(std::string(large), "[1,22,333]");
+
+    const char json[] = "{\"a\":[1,{}],\"b\":\"x\"}";
+    jsonpack::value v;
+    v.json_unpack(json, strlen(json));
+    BOOST_CHECK_EQUAL(v.json_pack(nullptr, 0), strlen(json));
+}
+
+BOOST_AUTO_TEST_CASE(empty_append_after_fixed_buffer_overflow)
+{
+    char* heap = static_cast<char*>(malloc(4));
+    jsonpack::buffer json(heap, 4);
+
+    json.append("[1,2,3]", 7);
+    BOOST_CHECK(json.overflow());
+
+    json.append(heap, 0);
+    json.append_large(heap, 0);
+
+    jsonpack::writer w(json);
+    w.raw(heap, 0);
+
+    BOOST_CHECK_EQUAL(json.size(), 7u);
+    free(heap);
+}
+
+BOOST_AUTO_TEST_CASE(pack_into_pooled_and_caller_storage)
+{
+    TestOrder order;
+    order.item.id = 7;
+    order.item.name = "pen";
+    order.qty = 3;
+    const std::string expected = "{\"item\":{\"id\":7,\"name\":\"pen\"},\"qty\":3}";
+
+    jsonpack::buffer_pool::trim();
+    const char *block = nullptr;
+    {
+        jsonpack::packed json = jsonpack::json_pack_pooled(order);
+        BOOST_CHECK_EQUAL(json.str(), expected);
+        BOOST_CHECK_EQUAL(json.size(), expected.size());
+        BOOST_CHECK_EQUAL(json.data()[json.size()], '\0');
+        block = json.data();
+
+        jsonpack::packed moved = std::move(json);
+        BOOST_CHECK(json.empty());
+        BOOST_CHECK(moved.data() == block);
+    }
+    BOOST_CHECK_EQUAL(jsonpack::buffer_pool::cached(), 1u);
+
+    std::vector<int> seq = {1, 2};
+    jsonpack::packed again = jsonpack::json_pack_sequence_pooled(seq);
+    BOOST_CHECK(again.data() == block);     // the same block, no malloc
+    BOOST_CHECK_EQUAL(again.str(), "[1,2]");
+    BOOST_CHECK_EQUAL(jsonpack::buffer_pool::cached(), 0u);
+
+    std::string out = "msg=";
+    order.json_pack(out);
+    BOOST_CHECK_EQUAL(out, "msg=" + expected);
+
+    out.clear();
+    std::map<std::string, int> map = { {"a", 1} };
+    jsonpack::json_pack_map(map, out);
+    BOOST_CHECK_EQUAL(out, "{\"a\":1}");
+
+    std::string big;
+    std::vector<std::string> texts(1000, std::string(20, 'x'));
+    jsonpack::json_pack_sequence(texts, big);
+    BOOST_CHECK_EQUAL(big.size(), 2 + 1000 * 22 + 999);
+
+    jsonpack::buffer json;
+    jsonpack::value v;
+    v.json_unpack(expected.data(), expected.size());
+    json.append("[", 1);
+    v.json_pack(json);
+    json.append("]", 1);
+    BOOST_CHECK_EQUAL(json.size(), expected.size() + 2);
+}
+
+struct TestRecord
+{
+    TestRecord():
+        order(),
+        price(0.0),
+        paid(false),
+        tags()
+    {}
+
+    TestOrder order;
+    double price;
+    bool paid;
+    std::vector<std::string> tags;
+    DEFINE_JSON_ATTRIBUTES(order, price, paid, tags)
+};
+
+BOOST_AUTO_TEST_CASE(writer_matches_struct_path)
+{
+    TestRecord r;
+    r.order.item.id = -7;
+    r.order.item.name = "pen \"blue\"";
+    r.order.qty = 1234567890123LL;
+    r.price = 2.5;
+    r.paid = true;
+    r.tags = {"a", "b\tc"};
+
+    for(int pretty = 0; pretty < 2; ++pretty)
+    {
+        char* expected = r.json_pack(pretty != 0, 2);
+
+        jsonpack::buffer json;
+        jsonpack::writer w(json, pretty != 0, 2);
+        w.begin_object()
+            .key(JSONPACK_KEY("order")).begin_object()
+                .key(JSONPACK_KEY("item")).value(r.order.item)
+                .key(std::string("qty")).value(r.order.qty)
+            .end_object()
+            .key(JSONPACK_KEY("price")).value(r.price)
+            .key(JSONPACK_KEY("paid")).value(r.paid)
+            .key("tags", 4).begin_array();
+        for(const std::string &t : r.tags)
+            w.value(t);
+        w.end_array().end_object();
+
+        BOOST_CHECK_EQUAL(std::string(json.data(), json.size()), std::string(expected));
+        free(expected);
+    }
+
+    // escaped names, null, raw text, chars, empty containers
+    jsonpack::buffer json;
+    jsonpack::writer w(json);
+    w.begin_array()
+        .begin_object().key(std::string("a\"b")).null().end_object()
+        .raw("{\"x\":[1]}", 9)
+        .value('q')
+        .value(static_cast<const char*>(nullptr))
+        .begin_array().end_array()
+        .value(0u)
+     .end_array();
+
+    BOOST_CHECK_EQUAL(std::string(json.data(), json.size()),
+                      "[{\"a\\\"b\":null},{\"x\":[1]},\"q\",null,[],0]");
+}
@@ -0,0 +1,380 @@
+#define BOOST_TEST_MAIN
+#if !defined( WIN32 )
+    #define BOOST_TEST_DYN_LINK
+#endif
+
+/**
+ * Boost.test causes the following warning under GCC
+ * error: base class 'struct boost::unit_test::ut_detail::nil_t' has
+ * a non-virtual destructor [-Werror=effc++]
+ */
+#if defined __GNUC__
+#pragma GCC diagnostic ignored "-Weffc++"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <jsonpack.hpp>
+#include <cstring>
+#include <map>
+
+struct  TestItem
+{
+    TestItem():
+        id(0),
+        tags()
+    {}
+
+    int id;
+    std::vector<std::string> tags;
+    DEFINE_JSON_ATTRIBUTES(id, tags)
+};
+
+BOOST_AUTO_TEST_CASE(unpack_sequences_of_every_kind)
+{
+    const char json[] = "[3,1,2,1]";
+    const std::size_t len = strlen(json);
+
+    std::vector<int> v;
+    jsonpack::json_unpack_sequence(json, len, v);
+    BOOST_CHECK(v == std::vector<int>({3,1,2,1}));
+
+    std::deque<int> d;
+    jsonpack::json_unpack_sequence(json, len, d);
+    BOOST_CHECK(d == std::deque<int>({3,1,2,1}));
+
+    std::list<int> l;
+    jsonpack::json_unpack_sequence(json, len, l);
+    BOOST_CHECK(l == std::list<int>({3,1,2,1}));
+
+    std::set<int> s;
+    jsonpack::json_unpack_sequence(json, len, s);
+    BOOST_CHECK(s == std::set<int>({1,2,3}));
+
+    std::unordered_set<int> us;
+    jsonpack::json_unpack_sequence(json, len, us);
+    BOOST_CHECK_EQUAL(us.size(), 3u);
+
+    std::forward_list<int> fl; // items come in inverse order
+    jsonpack::json_unpack_sequence(json, len, fl);
+    BOOST_CHECK(fl == std::forward_list<int>({1,2,1,3}));
+
+    std::array<int,4> a;
+    jsonpack::json_unpack_sequence(json, len, a);
+    BOOST_CHECK(a == (std::array<int,4>{{3,1,2,1}}));
+
+    std::array<int,2> small;
+    BOOST_CHECK_THROW(jsonpack::json_unpack_sequence(json, len, small), jsonpack::type_error);
+
+    const char bools[] = "[true,false,true]";
+    std::vector<bool> b;
+    jsonpack::json_unpack_sequence(bools, strlen(bools), b);
+    BOOST_CHECK(b == std::vector<bool>({true,false,true}));
+}
+
+BOOST_AUTO_TEST_CASE(unpack_vector_of_objects)
+{
+    const char json[] = "[{\"id\":1,\"tags\":[\"a\",\"b\"]},{\"id\":2,\"tags\":[]},{\"id\":3}]";
+
+    std::vector<TestItem> items;
+    jsonpack::json_unpack_sequence(json, strlen(json), items);
+
+    BOOST_REQUIRE_EQUAL(items.size(), 3u);
+    BOOST_CHECK_EQUAL(items[0].id, 1);
+    BOOST_CHECK_EQUAL(items[0].tags.size(), 2u);
+    BOOST_CHECK_EQUAL(items[0].tags[1], "b");
+    BOOST_CHECK_EQUAL(items[1].id, 2);
+    BOOST_CHECK(items[1].tags.empty());
+    BOOST_CHECK_EQUAL(items[2].id, 3);
+
+    const char mismatch[] = "[{\"id\":1},2]";
+    BOOST_CHECK_THROW(jsonpack::json_unpack_sequence(mismatch, strlen(mismatch), items), jsonpack::type_error);
+}
+
+BOOST_AUTO_TEST_CASE(unpack_sequences_of_literals)
+{
+    const char ints[] = " [ 0, -7, 123456789012, 9223372036854775807, -9223372036854775808 ] ";
+    std::vector<long long> ll;
+    jsonpack::json_unpack_sequence(ints, strlen(ints), ll);
+    BOOST_REQUIRE_EQUAL(ll.size(), 5u);
+    BOOST_CHECK_EQUAL(ll[2], 123456789012LL);
+    BOOST_CHECK_EQUAL(ll[3], std::numeric_limits<long long>::max());
+    BOOST_CHECK_EQUAL(ll[4], std::numeric_limits<long long>::min());
+
+    const char big[] = "[18446744073709551615, 18446744073709551616]";
+    std::vector<unsigned long long> u;
+    BOOST_CHECK_THROW(jsonpack::json_unpack_sequence(big, strlen(big), u), jsonpack::type_error);
+
+    const char reals[] = "[0.1, -2.5e3, 1e-300, 3, 12345678901234567890.5, 1.7976931348623157e308]";
+    std::vector<double> d;
+    jsonpack::json_unpack_sequence(reals, strlen(reals), d);
+    BOOST_REQUIRE_EQUAL(d.size(), 6u);
+    BOOST_CHECK_EQUAL(d[0], 0.1);
+    BOOST_CHECK_EQUAL(d[1], -2500.0);
+    BOOST_CHECK_EQUAL(d[2], 1e-300);
+    BOOST_CHECK_EQUAL(d[3], 3.0);
+    BOOST_CHECK_EQUAL(d[4], 12345678901234567890.5);
+    BOOST_CHECK_EQUAL(d[5], std::numeric_limits<double>::max());
+
+    const char floats[] = "[0.1, 16777217, 3.4028234663852886e38]";
+    std::list<float> f;
+    jsonpack::json_unpack_sequence(floats, strlen(floats), f);
+    BOOST_REQUIRE_EQUAL(f.size(), 3u);
+    BOOST_CHECK_EQUAL(f.front(), 0.1f);
+    BOOST_CHECK_EQUAL(*std::next(f.begin()), 16777216.0f);
+    BOOST_CHECK_EQUAL(f.back(), std::numeric_limits<float>::max());
+
+    const char strings[] = "[\"a,b\", \"tab\\t\", null, \"\"]";
+    std::vector<std::string> s;
+    jsonpack::json_unpack_sequence(strings, strlen(strings), s);
+    BOOST_REQUIRE_EQUAL(s.size(), 4u);
+    BOOST_CHECK_EQUAL(s[0], "a,b");
+    BOOST_CHECK_EQUAL(s[1], "tab\t");
+    BOOST_CHECK(s[2].empty() && s[3].empty());
+
+    const char empty[] = "[]";
+    jsonpack::json_unpack_sequence(empty, strlen(empty), s);
+    BOOST_CHECK(s.empty());
+
+    const char nested[] = "[1,[2]]";
+    BOOST_CHECK_THROW(jsonpack::json_unpack_sequence(nested, strlen(nested), d), jsonpack::type_error);
+
+    const char bad[][16] = { "[1,]", "[1 2]", "[1", "[1]]", "{}", "[1,[2" };
+    for(const auto &json : bad)
+        BOOST_CHECK_THROW(jsonpack::json_unpack_sequence(json, strlen(json), d), jsonpack::invalid_json);
+}
+
+BOOST_AUTO_TEST_CASE(sequence_of_literals_errors_match_parser)
+{
+    const char syntax[][16] = { "", "{}", "[", "[1,]", "[1 2]", "[1", "[1]]", "[,1]", "[1,01]", "[\"\\q\"]" };
+    for(const auto &json : syntax)
+    {
+        jsonpack::array_t items;
+        jsonpack::parser p;
+        jsonpack::error expected;
+        BOOST_REQUIRE(!p.try_validate(json, strlen(json), items, expected));
+
+        std::vector<int> v;
+        jsonpack::error err = jsonpack::try_json_unpack_sequence(json, strlen(json), v);
+        BOOST_CHECK_EQUAL(err._code, expected._code);
+        BOOST_CHECK_EQUAL(err._offset, expected._offset);
+        BOOST_CHECK_EQUAL(err.message(), expected.message());
+    }
+
+    std::vector<int> v;
+    jsonpack::error err = jsonpack::try_json_unpack_sequence("", 0, v);
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_EMPTY);
+
+    const char mismatch[] = "[1, \"a\"]";
+    err = jsonpack::try_json_unpack_sequence(mismatch, strlen(mismatch), v);
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_TYPE_MISMATCH);
+    BOOST_CHECK_EQUAL(err._offset, strchr(mismatch, 'a') - mismatch);
+    BOOST_CHECK_THROW(jsonpack::json_unpack_sequence(mismatch, strlen(mismatch), v), jsonpack::type_error);
+
+    const char nested[] = "[1, [2]]";
+    err = jsonpack::try_json_unpack_sequence(nested, strlen(nested), v);
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_TYPE_MISMATCH);
+    BOOST_CHECK_EQUAL(err._offset, 4u);
+
+    const char broken[] = "[1, [2 3]]";
+    err = jsonpack::try_json_unpack_sequence(broken, strlen(broken), v);
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_INVALID_VALUE);
+    BOOST_CHECK_EQUAL(err._offset, 7u);
+
+    const char range[] = "[1, 18446744073709551616]";
+    std::vector<unsigned long long> u;
+    err = jsonpack::try_json_unpack_sequence(range, strlen(range), u);
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_OUT_OF_RANGE);
+    BOOST_CHECK_EQUAL(err._offset, 4u);
+
+    const char ok[] = "[1, 2]";
+    BOOST_CHECK(jsonpack::try_json_unpack_sequence(ok, strlen(ok), v).ok());
+    BOOST_CHECK_EQUAL(v.size(), 2u);
+
+    std::vector<TestItem> items;
+    const char truncated[] = "[{\"id\":1},";
+    err = jsonpack::try_json_unpack_sequence(truncated, strlen(truncated), items);
+    BOOST_CHECK_EQUAL(err._code, jsonpack::JERR_EXPECT_VALUE);
+    BOOST_CHECK_EQUAL(err._offset, strlen(truncated));
+}
+
+BOOST_AUTO_TEST_CASE(merge_into_existing_items)
+{
+    const char first[] = "[{\"id\":1,\"tags\":[\"a long tag that is not inline\"]},{\"id\":2},{\"id\":3}]";
+    std::vector<TestItem> items;
+    jsonpack::json_merge_sequence(first, strlen(first), items);
+    BOOST_REQUIRE_EQUAL(items.size(), 3u);
+
+    const TestItem *data = items.data();
+    const std::string *tag = items[0].tags.data();
+    const char *tag_data = items[0].tags[0].data();
+
+    const char second[] = "[{\"id\":10,\"tags\":[\"short\"]},{\"id\":20}]";
+    jsonpack::json_merge_sequence(second, strlen(second), items);
+    BOOST_REQUIRE_EQUAL(items.size(), 2u);
+    BOOST_CHECK(items.data() == data);
+    BOOST_CHECK(items[0].tags.data() == tag);
+    BOOST_CHECK(items[0].tags[0].data() == tag_data);
+    BOOST_CHECK_EQUAL(items[0].id, 10);
+    BOOST_CHECK_EQUAL(items[0].tags[0], "short");
+    BOOST_CHECK_EQUAL(items[1].id, 20);
+
+    jsonpack::json_merge_sequence(first, strlen(first), items);
+    BOOST_REQUIRE_EQUAL(items.size(), 3u);
+    BOOST_CHECK_EQUAL(items[2].id, 3);
+
+    // literals are reused by the plain unpack too, null resets the item
+    std::vector<std::string> s(1, "a long string that is not inline");
+    const char *s_data = s[0].data();
+    const char strings[] = "[\"x\",null]";
+    jsonpack::json_unpack_sequence(strings, strlen(strings), s);
+    BOOST_REQUIRE_EQUAL(s.size(), 2u);
+    BOOST_CHECK(s[0].data() == s_data);
+    BOOST_CHECK_EQUAL(s[0], "x");
+    BOOST_CHECK(s[1].empty());
+}
+
+BOOST_AUTO_TEST_CASE(unpack_maps_of_every_kind)
+{
+    const char json[] = "{\"one\":[1],\"two\":[2,2],\"three\":[]}";
+    const std::size_t len = strlen(json);
+
+    std::map<std::string, std::vector<int>> m;
+    jsonpack::json_unpack_map(json, len, m);
+    BOOST_REQUIRE_EQUAL(m.size(), 3u);
+    BOOST_CHECK(m["two"] == std::vector<int>({2,2}));
+    BOOST_CHECK(m["three"].empty());
+
+    std::unordered_map<std::string, std::vector<int>> um;
+    jsonpack::json_unpack_map(json, len, um);
+    BOOST_REQUIRE_EQUAL(um.size(), 3u);
+    BOOST_CHECK(um["one"] == std::vector<int>({1}));
+
+    std::multimap<std::string, std::vector<int>> mm;
+    jsonpack::json_unpack_map(json, len, mm);
+    BOOST_CHECK_EQUAL(mm.size(), 3u);
+
+    std::unordered_multimap<std::string, std::vector<int>> umm;
+    jsonpack::json_unpack_map(json, len, umm);
+    BOOST_CHECK_EQUAL(umm.size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_pack_matches_serial)
+{
+    std::vector<TestItem> items(5000);
+    for(std::size_t i = 0; i < items.size(); ++i)
+    {
+        items[i].id = static_cast<int>(i);
+        items[i].tags.assign(i % 3, "tag\t" + std::to_string(i));
+    }
+
+    for(int pretty = 0; pretty < 2; ++pretty)
+    {
+        char* serial = jsonpack::json_pack_sequence(items, pretty != 0, 2);
+        for(unsigned threads = 0; threads < 5; ++threads)
+        {
+            char* parallel = jsonpack::json_pack_sequence_parallel(items, threads, pretty != 0, 2);
+            BOOST_CHECK_EQUAL(std::string(parallel), std::string(serial));
+            free(parallel);
+        }
+        free(serial);
+    }
+
+    // an error in any slice reaches the caller
+    items[4321].tags.assign(1, "\xff");
+    BOOST_CHECK_THROW(free(jsonpack::json_pack_sequence_parallel(items, 4)), jsonpack::invalid_json);
+}
+
+struct TestGroup
+{
+    TestGroup():
+        name(),
+        items(),
+        counts(),
+        flags(),
+        total(0)
+    {}
+
+    std::string name;
+    std::vector<TestItem> items;
+    std::map<std::string, std::vector<int>> counts;
+    std::vector<bool> flags;
+    int total;
+    DEFINE_JSON_ATTRIBUTES(name, items, counts, flags, total)
+};
+
+template<typename T>
+std::string drain(jsonpack::chunked<T> &out, const std::size_t &n)
+{
+    std::string text;
+    std::vector<char> chunk(n);
+    while(!out.done())
+    {
+        std::size_t count = out.next_chunk(chunk.data(), n);
+        BOOST_CHECK(count == n || out.done());
+        text.append(chunk.data(), count);
+    }
+    BOOST_CHECK_EQUAL(out.next_chunk(chunk.data(), n), 0u);
+    return text;
+}
+
+BOOST_AUTO_TEST_CASE(chunked_pack_matches_whole)
+{
+    std::vector<TestItem> items(300);
+    std::map<std::string, TestItem> by_name;
+    for(std::size_t i = 0; i < items.size(); ++i)
+    {
+        items[i].id = static_cast<int>(i);
+        items[i].tags.assign(i % 3, "tag " + std::to_string(i));
+        by_name["item" + std::to_string(i)] = items[i];
+    }
+    std::vector<int> empty;
+
+    std::vector<TestGroup> groups(3);
+    groups[0].name = "first";
+    groups[0].items.assign(items.begin(), items.begin() + 50);
+    groups[0].counts["a"] = std::vector<int>({1, 2});
+    groups[0].counts["b"];
+    groups[0].flags.assign(5, true);
+    groups[0].total = 50;
+    groups[2].items.assign(1, items[1]);
+
+    const std::size_t sizes[] = { 1, 7, 100, 1 << 16 };
+    for(int pretty = 0; pretty < 2; ++pretty)
+    {
+        char* whole = jsonpack::json_pack_sequence(items, pretty != 0, 2);
+        char* whole_map = jsonpack::json_pack_map(by_name, pretty != 0, 2);
+        char* whole_empty = jsonpack::json_pack_sequence(empty, pretty != 0, 2);
+        char* whole_item = items[7].json_pack(pretty != 0, 2);
+        char* whole_groups = jsonpack::json_pack_sequence(groups, pretty != 0, 2);
+        char* whole_group = groups[0].json_pack(pretty != 0, 2);
+
+        for(std::size_t n : sizes)
+        {
+            jsonpack::chunked< std::vector<TestItem> > seq(items, pretty != 0, 2);
+            BOOST_CHECK_EQUAL(drain(seq, n), std::string(whole));
+
+            jsonpack::chunked< std::map<std::string, TestItem> > map(by_name, pretty != 0, 2);
+            BOOST_CHECK_EQUAL(drain(map, n), std::string(whole_map));
+
+            jsonpack::chunked< std::vector<int> > none(empty, pretty != 0, 2);
+            BOOST_CHECK_EQUAL(drain(none, n), std::string(whole_empty));
+
+            jsonpack::chunked<TestItem> item(items[7], pretty != 0, 2);
+            BOOST_CHECK_EQUAL(drain(item, n), std::string(whole_item));
+
+            jsonpack::chunked< std::vector<TestGroup> > nested(groups, pretty != 0, 2);
+            BOOST_CHECK_EQUAL(drain(nested, n), std::string(whole_groups));
+
+            jsonpack::chunked<TestGroup> group(groups[0], pretty != 0, 2);
+            BOOST_CHECK_EQUAL(drain(group, n), std::string(whole_group));
+        }
+
+        free(whole);
+        free(whole_map);
+        free(whole_empty);
+        free(whole_item);
+        free(whole_groups);
+        free(whole_group);
+    }
+}
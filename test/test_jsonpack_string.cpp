@@ -0,0 +1,195 @@
+#define BOOST_TEST_MAIN
+#if !defined( WIN32 )
+    #define BOOST_TEST_DYN_LINK
+#endif
+
+/**
+ * Boost.test causes the following warning under GCC
+ * error: base class 'struct boost::unit_test::ut_detail::nil_t' has
+ * a non-virtual destructor [-Werror=effc++]
+ */
+#if defined __GNUC__
+#pragma GCC diagnostic ignored "-Weffc++"
+#endif
+
+#include <boost/test/unit_test.hpp>
+
+#include <jsonpack.hpp>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct  TestString
+{
+    TestString():
+        plain(),
+        escaped()
+    {}
+
+    std::string plain;
+    std::string escaped;
+    DEFINE_JSON_ATTRIBUTES(plain, escaped)
+};
+
+BOOST_AUTO_TEST_CASE(unpack_strings_with_and_without_escapes)
+{
+    const char json[] = "{\"plain\":\"no escapes here\",\"escaped\":\"tab\\there \\\"q\\\" \\u00e9\"}";
+
+    TestString out;
+    out.json_unpack(json, strlen(json));
+
+    BOOST_CHECK_EQUAL(out.plain, "no escapes here");
+    BOOST_CHECK_EQUAL(out.escaped, "tab\there \"q\" \xc3\xa9");
+}
+
+BOOST_AUTO_TEST_CASE(escape_flag_recorded_by_scanner)
+{
+    const char json[] = "[\"clean\",\"dir\\/name\"]";
+
+    jsonpack::value v;
+    v.json_unpack(json, strlen(json));
+
+    BOOST_CHECK(!v[0].escaped());
+    BOOST_CHECK(v[1].escaped());
+    BOOST_CHECK_EQUAL(v[1].get<std::string>(), "dir/name");
+}
+
+BOOST_AUTO_TEST_CASE(simd_levels_agree_with_scalar)
+{
+    using jsonpack::util::simd;
+
+    // every special byte at every offset of a buffer longer than one AVX-512 block
+    const char specials[] = { '"', '\\', '{', '}', '[', ']', '\n', '\x1f', '\x7f', '\xc3', 'a' };
+    std::vector<std::string> inputs;
+    for(char c : specials)
+    {
+        for(std::size_t at = 0; at < 150; ++at)
+        {
+            std::string s(150, 'x');
+            s[at] = c;
+            inputs.push_back(s);
+        }
+    }
+
+    const jsonpack::util::simd_level initial = simd::active();
+
+    BOOST_REQUIRE(simd::select(jsonpack::util::SIMD_SCALAR));
+    std::vector<const char*> expected;
+    for(const auto &s : inputs)
+    {
+        const char *p = s.data(), *end = p + s.size();
+        expected.push_back(simd::find_string_special(p, end));
+        expected.push_back(simd::find_escape(p, end));
+    }
+
+    const char json[] = "{\"plain\":\"a long enough string to fill more than one block of sixty four bytes\","
+                        "\"escaped\":\"tab\\there \\\"q\\\" \\u00e9 and then another fairly long tail of text\"}";
+    TestString reference;
+    reference.json_unpack(json, strlen(json));
+    char *packed = reference.json_pack();
+    std::string reference_packed(packed);
+    free(packed);
+
+    for(unsigned l = jsonpack::util::SIMD_SCALAR; l < jsonpack::util::SIMD_LEVELS; ++l)
+    {
+        if( !simd::select( static_cast<jsonpack::util::simd_level>(l) ) )
+            continue;
+
+        std::size_t e = 0;
+        for(const auto &s : inputs)
+        {
+            const char *p = s.data(), *end = p + s.size();
+            BOOST_CHECK(simd::find_string_special(p, end) == expected[e++]);
+            BOOST_CHECK(simd::find_escape(p, end) == expected[e++]);
+        }
+
+        TestString out;
+        out.json_unpack(json, strlen(json));
+        BOOST_CHECK_EQUAL(out.plain, reference.plain);
+        BOOST_CHECK_EQUAL(out.escaped, reference.escaped);
+
+        packed = out.json_pack();
+        BOOST_CHECK_EQUAL(std::string(packed), reference_packed);
+        free(packed);
+    }
+
+    BOOST_CHECK(simd::select(initial));
+    BOOST_CHECK(!simd::select(jsonpack::util::SIMD_LEVELS));
+}
+
+BOOST_AUTO_TEST_CASE(gather_references_large_strings)
+{
+    TestString in;
+    in.plain.assign(200, 'x');              // referenced
+    in.escaped = std::string(300, 'y') + "\ttab";   // needs escapes, copied
+
+    char* expected = in.json_pack();
+
+    jsonpack::gather_output out(64);
+    in.json_pack(out.json());
+
+    BOOST_CHECK_EQUAL(out.str(), std::string(expected));
+    BOOST_CHECK_EQUAL(out.size(), strlen(expected));
+    BOOST_CHECK_EQUAL(out.pieces(), 3u);
+
+    bool referenced = false;
+    out.for_each([&](const char* data, std::size_t len)
+    {
+        if(data == in.plain.data())
+            referenced = (len == in.plain.size());
+    });
+    BOOST_CHECK(referenced);
+
+    // string literals of a DOM are referenced from the parsed text
+    std::string text(expected);
+    jsonpack::value v;
+    v.json_unpack(&text[0], text.size());
+
+    out.clear();
+    v.json_pack(out.json());
+    BOOST_CHECK_EQUAL(out.size(), strlen(expected));
+    BOOST_CHECK(out.pieces() > 1);
+
+#ifndef _WIN32
+    FILE* tmp = tmpfile();
+    BOOST_REQUIRE(tmp != nullptr);
+
+    out.clear();
+    in.json_pack(out.json());
+    BOOST_CHECK(out.write(fileno(tmp)));
+
+    std::string written(out.size(), '\0');
+    rewind(tmp);
+    BOOST_CHECK_EQUAL(fread(&written[0], 1, written.size(), tmp), written.size());
+    BOOST_CHECK_EQUAL(written, std::string(expected));
+    fclose(tmp);
+#endif
+
+    free(expected);
+}
+
+BOOST_AUTO_TEST_CASE(supplementary_plane_round_trip)
+{
+    const std::string emoji = "\xF0\x9F\x98\x80";   // U+1F600, 4 bytes in UTF-8
+
+    TestString in;
+    in.plain = "smile " + emoji;
+    in.escaped = emoji + "\t" + emoji;
+
+    char* packed = in.json_pack();
+    BOOST_CHECK( std::string(packed).find("\\uD83D\\uDE00") != std::string::npos );
+
+    TestString out;
+    out.json_unpack(packed, strlen(packed));
+    BOOST_CHECK_EQUAL(out.plain, in.plain);
+    BOOST_CHECK_EQUAL(out.escaped, in.escaped);
+    free(packed);
+
+    // the character as raw UTF-8 in the input
+    const std::string json = "{\"plain\":\"" + emoji + "\",\"escaped\":\"\\ud83d\\ude00\"}";
+    TestString raw;
+    raw.json_unpack(json.data(), json.size());
+    BOOST_CHECK_EQUAL(raw.plain, emoji);
+    BOOST_CHECK_EQUAL(raw.escaped, emoji);
+}